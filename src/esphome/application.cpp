@@ -83,6 +83,7 @@ void Application::setup() {
         global_state |= new_global_state;
       }
       global_state = new_global_state;
+      global_preferences.loop();
       yield();
     } while (!component->can_proceed());
   }
@@ -105,6 +106,8 @@ void Application::dump_config() {
   }
 }
 void Application::schedule_dump_config() { this->dump_config_scheduled_ = true; }
+uint32_t Application::get_max_loop_time() const { return this->max_loop_time_; }
+void Application::reset_max_loop_time() { this->max_loop_time_ = 0; }
 
 void HOT Application::loop() {
   bool first_loop = this->application_state_ == COMPONENT_STATE_SETUP;
@@ -113,6 +116,7 @@ void HOT Application::loop() {
     this->application_state_ = COMPONENT_STATE_LOOP;
   }
 
+  const uint32_t loop_start = millis();
   uint32_t new_global_state = 0;
   for (Component *component : this->components_) {
     if (!component->is_failed()) {
@@ -123,8 +127,10 @@ void HOT Application::loop() {
     feed_wdt();
   }
   global_state = new_global_state;
+  global_preferences.loop();
 
   const uint32_t now = millis();
+  this->max_loop_time_ = std::max(this->max_loop_time_, now - loop_start);
   if (HighFrequencyLoopRequester::is_high_frequency()) {
     yield();
   } else {
@@ -313,6 +319,7 @@ Application::MakeLight Application::make_cwww_light(const std::string &friendly_
 
 #ifdef USE_LIGHT
 void Application::register_light(LightState *state) {
+  this->lights_.push_back(state);
   for (auto *controller : this->controllers_)
     controller->register_light(state);
 #ifdef USE_MQTT_LIGHT
@@ -411,6 +418,11 @@ sensor::PulseCounterSensorComponent *Application::make_pulse_counter_sensor(cons
                                                                             uint32_t update_interval) {
   auto *pcnt = this->register_component(new PulseCounterSensorComponent(friendly_name, pin.copy(), update_interval));
   this->register_sensor(pcnt);
+#ifdef USE_MQTT_SENSOR
+  // pulses counted while disconnected can't be recovered from the latest state
+  if (pcnt->get_mqtt() != nullptr)
+    pcnt->get_mqtt()->set_offline_history(true);
+#endif
   return pcnt;
 }
 #endif
@@ -534,7 +546,15 @@ sensor::HDC1080Component *Application::make_hdc1080_sensor(const std::string &te
 #endif
 
 #ifdef USE_DEBUG_COMPONENT
-DebugComponent *Application::make_debug_component() { return this->register_component(new DebugComponent()); }
+DebugComponent *Application::make_debug_component() {
+  auto *debug = this->register_component(new DebugComponent());
+  // register as controller to get notified of the lights, including the ones that already exist
+#ifdef USE_LIGHT
+  for (auto *light : this->lights_)
+    debug->register_light(light);
+#endif
+  return this->register_controller(debug);
+}
 #endif
 
 #ifdef USE_FAN
@@ -683,6 +703,21 @@ Application::MakeFastLEDLight Application::make_fast_led_light(const std::string
 }
 #endif
 
+#ifdef USE_ESP32_RMT_LED_STRIP
+Application::MakeESP32RMTLEDStripLight Application::make_esp32_rmt_led_strip_light(const std::string &name,
+                                                                                  const GPIOOutputPin &pin,
+                                                                                  uint16_t num_leds,
+                                                                                  light::ESP32RMTLEDChipset chipset) {
+  auto *output = this->register_component(new ESP32RMTLEDStripLightOutput(pin.copy(), num_leds, chipset));
+  auto make = this->make_light_for_light_output(name, output);
+
+  return MakeESP32RMTLEDStripLight{
+      .output = output,
+      .state = make.state,
+  };
+}
+#endif
+
 #ifdef USE_DHT12_SENSOR
 sensor::DHT12Component *Application::make_dht12_sensor(const std::string &temperature_name,
                                                        const std::string &humidity_name, uint32_t update_interval) {
@@ -934,6 +969,19 @@ display::I2CSSD1306 *Application::make_i2c_ssd1306(uint32_t update_interval) {
 #endif
 #endif
 
+#ifdef USE_ADDRESSABLE_LIGHT_DISPLAY
+display::AddressableLightDisplay *Application::make_addressable_light_display(light::AddressableMatrix *matrix,
+                                                                              uint32_t update_interval) {
+  return this->register_component(new display::AddressableLightDisplay(matrix, update_interval));
+}
+#endif
+
+#ifdef USE_MEMORY_DISPLAY
+display::MemoryDisplay *Application::make_memory_display(int width, int height, uint32_t update_interval) {
+  return this->register_component(new display::MemoryDisplay(width, height, update_interval));
+}
+#endif
+
 #ifdef USE_WAVESHARE_EPAPER
 display::WaveshareEPaperTypeA *Application::make_waveshare_epaper_type_a(SPIComponent *parent, const GPIOOutputPin &cs,
                                                                          const GPIOOutputPin &dc_pin,
@@ -963,12 +1011,20 @@ display::WaveshareEPaper *Application::make_waveshare_epaper_type_b(SPIComponent
 }
 #endif
 
+#ifdef USE_ST7735
+display::ST7735 *Application::make_st7735(SPIComponent *parent, const GPIOOutputPin &cs, const GPIOOutputPin &dc_pin,
+                                          display::ST7735Model model, uint32_t update_interval) {
+  return this->register_component(new display::ST7735(parent, cs.copy(), dc_pin.copy(), model, update_interval));
+}
+#endif
+
 #ifdef USE_DISPLAY
 display::Font *Application::make_font(std::vector<display::Glyph> &&glyphs, int baseline, int bottom) {
   return new display::Font(std::move(glyphs), baseline, bottom);
 }
-display::Image *Application::make_image(const uint8_t *data_start, int width, int height) {
-  return new display::Image(data_start, width, height);
+display::Image *Application::make_image(const uint8_t *data_start, int width, int height,
+                                        display::BitmapEncoding encoding) {
+  return new display::Image(data_start, width, height, encoding);
 }
 #endif
 
@@ -1097,6 +1153,10 @@ sensor::TotalDailyEnergy *Application::make_total_daily_energy_sensor(const std:
                                                                       sensor::Sensor *parent) {
   auto total = this->register_component(new TotalDailyEnergy(name, time, parent));
   this->register_sensor(total);
+#ifdef USE_MQTT_SENSOR
+  if (total->get_mqtt() != nullptr)
+    total->get_mqtt()->set_offline_history(true);
+#endif
   return total;
 }
 #endif
@@ -48,11 +48,14 @@
 #include "esphome/cover/time_based_cover.h"
 #include "esphome/cover/mqtt_cover_component.h"
 #include "esphome/cover/template_cover.h"
+#include "esphome/display/addressable_light_display.h"
 #include "esphome/display/display.h"
 #include "esphome/display/lcd_display.h"
 #include "esphome/display/max7219.h"
+#include "esphome/display/memory_display.h"
 #include "esphome/display/nextion.h"
 #include "esphome/display/ssd1306.h"
+#include "esphome/display/st7735.h"
 #include "esphome/display/waveshare_epaper.h"
 #include "esphome/fan/basic_fan_component.h"
 #include "esphome/fan/fan_state.h"
@@ -60,6 +63,9 @@
 #include "esphome/io/mcp23017.h"
 #include "esphome/io/pcf8574_component.h"
 #include "esphome/light/addressable_light_effect.h"
+#include "esphome/light/addressable_matrix.h"
+#include "esphome/light/addressable_stream_effect.h"
+#include "esphome/light/esp32_rmt_led_strip.h"
 #include "esphome/light/fast_led_light_output.h"
 #include "esphome/light/light_color_values.h"
 #include "esphome/light/light_effect.h"
@@ -294,7 +300,8 @@ class Application {
 #ifdef USE_DISPLAY
   display::Font *make_font(std::vector<display::Glyph> &&glyphs, int baseline, int bottom);
 
-  display::Image *make_image(const uint8_t *data_start, int width, int height);
+  display::Image *make_image(const uint8_t *data_start, int width, int height,
+                             display::BitmapEncoding encoding = display::BITMAP_ENCODING_RAW);
 #endif
 
 #ifdef USE_MAX7219
@@ -321,6 +328,26 @@ class Application {
 #endif
 #endif
 
+#ifdef USE_ADDRESSABLE_LIGHT_DISPLAY
+  /** Create a display that renders onto an LED matrix.
+   *
+   * @param matrix The matrix layout of the addressable light to draw on.
+   * @param update_interval The interval in ms to redraw the display.
+   */
+  display::AddressableLightDisplay *make_addressable_light_display(light::AddressableMatrix *matrix,
+                                                                   uint32_t update_interval = 50);
+#endif
+
+#ifdef USE_MEMORY_DISPLAY
+  /** Create a display that only renders into memory, for snapshots and render timings of a layout.
+   *
+   * @param width The width of the display in pixels.
+   * @param height The height of the display in pixels.
+   * @param update_interval The interval in ms to redraw the display.
+   */
+  display::MemoryDisplay *make_memory_display(int width, int height, uint32_t update_interval = 5000);
+#endif
+
 #ifdef USE_WAVESHARE_EPAPER
   display::WaveshareEPaperTypeA *make_waveshare_epaper_type_a(SPIComponent *parent, const GPIOOutputPin &cs,
                                                               const GPIOOutputPin &dc_pin,
@@ -333,6 +360,11 @@ class Application {
                                                          uint32_t update_interval = 10000);
 #endif
 
+#ifdef USE_ST7735
+  display::ST7735 *make_st7735(SPIComponent *parent, const GPIOOutputPin &cs, const GPIOOutputPin &dc_pin,
+                               display::ST7735Model model, uint32_t update_interval = 1000);
+#endif
+
 #ifdef USE_NEXTION
   display::Nextion *make_nextion(UARTComponent *parent, uint32_t update_interval = 5000);
 #endif
@@ -984,6 +1016,26 @@ class Application {
   MakeFastLEDLight make_fast_led_light(const std::string &name);
 #endif
 
+#ifdef USE_ESP32_RMT_LED_STRIP
+  struct MakeESP32RMTLEDStripLight {
+    light::ESP32RMTLEDStripLightOutput *output;
+    light::LightState *state;
+  };
+
+  /** Create a light for a WS2812 (or similar) LED strip driven by an ESP32 RMT channel.
+   *
+   * Each strip uses its own RMT channel, frames of all strips are sent at the same time.
+   *
+   * @param name The name of the light.
+   * @param pin The data pin of the strip.
+   * @param num_leds The number of LEDs in the strip.
+   * @param chipset The LED chip type, defines the bit timings.
+   */
+  MakeESP32RMTLEDStripLight make_esp32_rmt_led_strip_light(const std::string &name, const GPIOOutputPin &pin,
+                                                          uint16_t num_leds,
+                                                          light::ESP32RMTLEDChipset chipset = light::RMT_LED_WS2812);
+#endif
+
 #ifdef USE_NEO_PIXEL_BUS_LIGHT
   template<typename T_METHOD, typename T_COLOR_FEATURE> struct MakeNeoPixelBusLight {
     light::NeoPixelBusLightOutputBase<T_METHOD, T_COLOR_FEATURE> *output;
@@ -1193,6 +1245,15 @@ class Application {
    */
   void set_loop_interval(uint32_t loop_interval);
 
+  /** Get the longest time in ms a single loop() iteration took since the last reset_max_loop_time().
+   *
+   * The idle delay at the end of loop() is not included, so this is the worst-case latency
+   * components (and the network stack) had to wait for the main loop.
+   */
+  uint32_t get_max_loop_time() const;
+  /// Start a new measurement period for get_max_loop_time().
+  void reset_max_loop_time();
+
   void dump_config();
   void schedule_dump_config();
 
@@ -1201,6 +1262,10 @@ class Application {
 
   std::vector<Component *> components_{};
   std::vector<Controller *> controllers_{};
+#ifdef USE_LIGHT
+  /// All registered lights, for controllers that are created after them.
+  std::vector<light::LightState *> lights_{};
+#endif
 #ifdef USE_MQTT
   mqtt::MQTTClientComponent *mqtt_client_{nullptr};
 #endif
@@ -1211,6 +1276,7 @@ class Application {
   uint32_t application_state_{COMPONENT_STATE_CONSTRUCTION};
   uint32_t last_loop_{0};
   uint32_t loop_interval_{16};
+  uint32_t max_loop_time_{0};
 #ifdef USE_I2C
   I2CComponent *i2c_{nullptr};
 #endif
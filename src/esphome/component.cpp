@@ -34,6 +34,8 @@ const uint32_t STATUS_LED_ERROR = 0x0200;
 
 uint32_t global_state = 0;
 
+const uint32_t SEQUENCE_ABORT = 0xFFFFFFFF;
+
 float Component::get_loop_priority() const { return 0.0f; }
 
 float Component::get_setup_priority() const { return setup_priority::HARDWARE_LATE; }
@@ -115,7 +117,10 @@ void Component::loop_internal_() {
   this->component_state_ &= ~COMPONENT_STATE_MASK;
   this->component_state_ |= COMPONENT_STATE_LOOP;
 
-  for (unsigned int i = 0; i < this->time_functions_.size(); i++) {  // NOLINT
+  // Functions added while running these are only considered in the next loop() call, so that defer() from within
+  // a deferred function doesn't run in the same iteration.
+  const unsigned int count = this->time_functions_.size();
+  for (unsigned int i = 0; i < count; i++) {  // NOLINT
     const uint32_t now = millis();
     TimeFunction *tf = &this->time_functions_[i];
     if (tf->should_run(now)) {
@@ -153,6 +158,25 @@ void Component::mark_failed() {
   this->component_state_ |= COMPONENT_STATE_FAILED;
   this->status_set_error();
 }
+void Component::start_sequence(const std::string &name, std::vector<sequence_step_t> &&steps) {  // NOLINT
+  if (!name.empty())
+    this->cancel_sequence(name);
+  if (steps.empty())
+    return;
+  auto shared = std::make_shared<std::vector<sequence_step_t>>(std::move(steps));
+  this->run_sequence_step_(name, shared, 0);
+}
+bool Component::cancel_sequence(const std::string &name) {  // NOLINT
+  return this->cancel_timeout(name);
+}
+void Component::run_sequence_step_(const std::string &name, std::shared_ptr<std::vector<sequence_step_t>> steps,
+                                   size_t index) {
+  const uint32_t wait = (*steps)[index]();
+  if (wait == SEQUENCE_ABORT || index + 1 >= steps->size())
+    return;
+
+  this->set_timeout(name, wait, [this, name, steps, index]() { this->run_sequence_step_(name, steps, index + 1); });
+}
 void Component::defer(std::function<void()> &&f) { this->defer("", std::move(f)); }  // NOLINT
 bool Component::cancel_defer(const std::string &name) {                              // NOLINT
   return this->cancel_time_function_(name, TimeFunction::DEFER);
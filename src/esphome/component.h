@@ -2,6 +2,7 @@
 #define ESPHOME_COMPONENT_H
 
 #include <functional>
+#include <memory>
 #include <vector>
 #include "esphome/defines.h"
 #include "esphome/helpers.h"
@@ -35,6 +36,15 @@ extern const uint32_t STATUS_LED_ERROR;
 
 extern uint32_t global_state;
 
+/// Return value of a sequence step to stop the sequence without running the remaining steps.
+extern const uint32_t SEQUENCE_ABORT;
+
+/** A single step of a sequence, see Component::start_sequence.
+ *
+ * Returns the time in ms to wait before the next step is run, or SEQUENCE_ABORT.
+ */
+using sequence_step_t = std::function<uint32_t()>;
+
 #define LOG_UPDATE_INTERVAL(this) ESP_LOGCONFIG(TAG, "  Update Interval: %u ms", this->get_update_interval());
 
 /** The base class for all ESPHome components.
@@ -202,9 +212,32 @@ class Component {
   /// Cancel a defer callback using the specified name, name must not be empty.
   bool cancel_defer(const std::string &name);  // NOLINT
 
+  /** Run a sequence of steps with waits in between without blocking the main loop.
+   *
+   * This is useful for drivers that need to "send command, wait N ms, read, wait M ms, read". The first
+   * step is run immediately, each step returns how long to wait before the next step is run
+   * (or SEQUENCE_ABORT to stop early, for example on a communication error). The waits are done with
+   * timeouts, so the same timing caveats as for set_timeout() apply.
+   *
+   * If a sequence with the same name is already running, it is cancelled.
+   *
+   * @param name The name of the sequence, used for cancelling.
+   * @param steps The steps to run.
+   *
+   * @see cancel_sequence()
+   */
+  void start_sequence(const std::string &name, std::vector<sequence_step_t> &&steps);  // NOLINT
+
+  /// Cancel a running sequence, return whether a sequence was cancelled.
+  bool cancel_sequence(const std::string &name);  // NOLINT
+
   void loop_internal_();
   void setup_internal_();
 
+  /// Run the step at index of a sequence and schedule the next one.
+  void run_sequence_step_(const std::string &name, std::shared_ptr<std::vector<sequence_step_t>> steps,
+                          size_t index);
+
   /// Internal struct for storing timeout/interval functions.
   struct TimeFunction {
     std::string name;                             ///< The name/id of this TimeFunction.
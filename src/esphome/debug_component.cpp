@@ -3,6 +3,7 @@
 #ifdef USE_DEBUG_COMPONENT
 
 #include "esphome/debug_component.h"
+#include "esphome/application.h"
 #include "esphome/log.h"
 #include "esphome/helpers.h"
 #include <string>
@@ -21,12 +22,42 @@ void DebugComponent::setup() {
   this->status_set_error();
   return;
 #endif
+
+  this->set_interval("loop_time", 60000, [this]() {
+    uint32_t max_loop_time = App.get_max_loop_time();
+    App.reset_max_loop_time();
+    ESP_LOGD(TAG, "Max Loop Time: %u ms", max_loop_time);
+    if (max_loop_time > this->worst_loop_time_)
+      this->worst_loop_time_ = max_loop_time;
+#ifdef USE_LIGHT
+    this->log_light_stats_();
+#endif
+  });
+}
+
+#ifdef USE_LIGHT
+void DebugComponent::register_light(light::LightState *obj) { this->lights_.push_back(obj); }
+void DebugComponent::log_light_stats_() {
+  const uint32_t now = millis();
+  for (auto *light : this->lights_) {
+    light::LightEffectStats stats = light->get_effect_stats(true);
+    if (stats.frames == 0)
+      continue;
+    const float fps = stats.frames * 1000.0f / (now - stats.since);
+    ESP_LOGD(TAG, "Light '%s': %.1f FPS (target %u), max jitter %u us, max render time %u us, dropped %u, overruns %u",
+             light->get_name().c_str(), fps, light->get_effect_fps(), stats.max_jitter, stats.max_render_time,
+             stats.dropped, stats.overruns);
+  }
 }
+#endif
 
 void DebugComponent::dump_config() {
   ESP_LOGD(TAG, "ESPHome Core version %s", ESPHOME_VERSION);
   this->free_heap_ = ESP.getFreeHeap();
   ESP_LOGD(TAG, "Free Heap Size: %u bytes", this->free_heap_);
+  ESP_LOGD(TAG, "Worst-Case Loop Time: %u ms", this->worst_loop_time_);
+  ESP_LOGD(TAG, "Preferences: %u saves, %u unchanged, %u writes", global_preferences.get_save_count(),
+           global_preferences.get_unchanged_count(), global_preferences.get_write_count());
 
   const char *flash_mode;
   switch (ESP.getFlashChipMode()) {
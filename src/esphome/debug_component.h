@@ -6,19 +6,33 @@
 #ifdef USE_DEBUG_COMPONENT
 
 #include "esphome/component.h"
+#include "esphome/controller.h"
 
 ESPHOME_NAMESPACE_BEGIN
 
-/// The debug component prints out debug information like free heap size on startup.
-class DebugComponent : public Component {
+/** The debug component prints out debug information like free heap size on startup.
+ *
+ * Additionally, the longest main loop iteration and the effect frame rate of all lights
+ * are reported every minute.
+ */
+class DebugComponent : public Component, public Controller {
  public:
   void setup() override;
   void loop() override;
   float get_setup_priority() const override;
   void dump_config() override;
+#ifdef USE_LIGHT
+  void register_light(light::LightState *obj) override;
+#endif
 
  protected:
+#ifdef USE_LIGHT
+  void log_light_stats_();  // NOLINT
+
+  std::vector<light::LightState *> lights_;
+#endif
   uint32_t free_heap_{};
+  uint32_t worst_loop_time_{0};  ///< Longest main loop iteration in ms since boot.
 };
 
 ESPHOME_NAMESPACE_END
@@ -91,6 +91,7 @@
 #ifdef ARDUINO_ARCH_ESP32
 #define USE_ESP32_HALL_SENSOR
 #define USE_ESP32_CAMERA
+#define USE_ESP32_RMT_LED_STRIP
 #endif
 #define USE_DUTY_CYCLE_SENSOR
 #define USE_STATUS_LED
@@ -112,6 +113,9 @@
 #define USE_LCD_DISPLAY_PCF8574
 #define USE_SSD1306
 #define USE_WAVESHARE_EPAPER
+#define USE_ST7735
+#define USE_ADDRESSABLE_LIGHT_DISPLAY
+#define USE_MEMORY_DISPLAY
 #define USE_DISPLAY
 #define USE_TIME
 #define USE_SNTP_COMPONENT
@@ -197,6 +201,24 @@
 #define USE_ONE_WIRE
 #endif
 #endif
+#ifdef USE_ADDRESSABLE_LIGHT_DISPLAY
+#ifndef USE_DISPLAY
+#define USE_DISPLAY
+#endif
+#ifndef USE_LIGHT
+#define USE_LIGHT
+#endif
+#endif
+#ifdef USE_MEMORY_DISPLAY
+#ifndef USE_DISPLAY
+#define USE_DISPLAY
+#endif
+#endif
+#ifdef USE_ESP32_RMT_LED_STRIP
+#ifndef USE_LIGHT
+#define USE_LIGHT
+#endif
+#endif
 #ifdef USE_LIGHT
 #ifndef USE_OUTPUT
 #define USE_OUTPUT
@@ -0,0 +1,49 @@
+#include "esphome/defines.h"
+
+#ifdef USE_ADDRESSABLE_LIGHT_DISPLAY
+
+#include "esphome/display/addressable_light_display.h"
+#include "esphome/log.h"
+
+ESPHOME_NAMESPACE_BEGIN
+
+namespace display {
+
+static const char *TAG = "display.addressable_light";
+
+AddressableLightDisplay::AddressableLightDisplay(light::AddressableMatrix *matrix, uint32_t update_interval)
+    : PollingComponent(update_interval), matrix_(matrix) {}
+void AddressableLightDisplay::set_on_color(const light::ESPColor &on_color) { this->on_color_ = on_color; }
+bool AddressableLightDisplay::supports_rgb_colors_() const { return true; }
+void AddressableLightDisplay::fill_internal_(int color) { this->matrix_->fill(this->to_color_(color)); }
+void AddressableLightDisplay::update() {
+  if (!this->should_render_())
+    return;
+  this->do_update_();
+  this->matrix_->get_light()->schedule_show();
+}
+void AddressableLightDisplay::dump_config() {
+  LOG_DISPLAY("", "Addressable Light Display", this);
+  LOG_UPDATE_INTERVAL(this);
+}
+float AddressableLightDisplay::get_setup_priority() const { return setup_priority::POST_HARDWARE; }
+void HOT AddressableLightDisplay::draw_absolute_pixel_internal(int x, int y, int color) {
+  if (!this->matrix_->is_in_bounds(x, y))
+    return;
+  (*this->matrix_)(x, y) = this->to_color_(color);
+}
+int AddressableLightDisplay::get_height_internal() { return this->matrix_->get_height(); }
+int AddressableLightDisplay::get_width_internal() { return this->matrix_->get_width(); }
+light::ESPColor AddressableLightDisplay::to_color_(int color) const {
+  if (color == COLOR_ON)
+    return this->on_color_;
+  if (color & COLOR_RGB_FLAG)
+    return light::ESPColor(uint32_t(color & 0xFFFFFF));
+  return light::ESPColor(uint32_t(color));
+}
+
+}  // namespace display
+
+ESPHOME_NAMESPACE_END
+
+#endif  // USE_ADDRESSABLE_LIGHT_DISPLAY
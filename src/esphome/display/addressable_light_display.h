@@ -0,0 +1,50 @@
+#ifndef ESPHOME_DISPLAY_ADDRESSABLE_LIGHT_DISPLAY_H
+#define ESPHOME_DISPLAY_ADDRESSABLE_LIGHT_DISPLAY_H
+
+#include "esphome/defines.h"
+
+#ifdef USE_ADDRESSABLE_LIGHT_DISPLAY
+
+#include "esphome/component.h"
+#include "esphome/display/display.h"
+#include "esphome/light/addressable_matrix.h"
+
+ESPHOME_NAMESPACE_BEGIN
+
+namespace display {
+
+/** Render text, images and shapes of a DisplayBuffer onto an LED matrix.
+ *
+ * COLOR_ON pixels are drawn with the on color (white by default), COLOR_OFF pixels are black, color_rgb() colors
+ * are drawn as they are and all other colors are interpreted as 0xWWRRGGBB. Brightness is controlled by the light the matrix is wired to.
+ */
+class AddressableLightDisplay : public PollingComponent, public DisplayBuffer {
+ public:
+  AddressableLightDisplay(light::AddressableMatrix *matrix, uint32_t update_interval = 50);
+
+  /// Set the color used for COLOR_ON pixels.
+  void set_on_color(const light::ESPColor &on_color);
+
+  void update() override;
+  void dump_config() override;
+  float get_setup_priority() const override;
+
+ protected:
+  bool supports_rgb_colors_() const override;
+  void fill_internal_(int color) override;
+  void draw_absolute_pixel_internal(int x, int y, int color) override;
+  int get_height_internal() override;
+  int get_width_internal() override;
+  light::ESPColor to_color_(int color) const;
+
+  light::AddressableMatrix *matrix_;
+  light::ESPColor on_color_{255, 255, 255, 255};
+};
+
+}  // namespace display
+
+ESPHOME_NAMESPACE_END
+
+#endif  // USE_ADDRESSABLE_LIGHT_DISPLAY
+
+#endif  // ESPHOME_DISPLAY_ADDRESSABLE_LIGHT_DISPLAY_H
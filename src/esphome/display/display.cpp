@@ -12,6 +12,9 @@ ESPHOME_NAMESPACE_BEGIN
 
 const uint8_t COLOR_OFF = 0;
 const uint8_t COLOR_ON = 1;
+int color_rgb(uint8_t red, uint8_t green, uint8_t blue) {
+  return COLOR_RGB_FLAG | (int(red) << 16) | (int(green) << 8) | blue;
+}
 
 namespace display {
 
@@ -25,7 +28,63 @@ void DisplayBuffer::init_internal_(uint32_t buffer_length) {
   }
   this->clear();
 }
-void DisplayBuffer::fill(int color) { this->filled_rectangle(0, 0, this->get_width(), this->get_height(), color); }
+void DisplayBuffer::init_render_task_() {
+#ifdef ARDUINO_ARCH_ESP32
+  if (this->render_in_background_) {
+    this->render_done_ = xSemaphoreCreateBinary();
+    // run on the core the main loop doesn't run on
+    const BaseType_t core = portNUM_PROCESSORS - 1 - xPortGetCoreID();
+    if (this->render_done_ == nullptr ||
+        xTaskCreatePinnedToCore(DisplayBuffer::render_task_, "display_render", this->render_task_stack_size_, this, 1,
+                                &this->render_task_handle_, core) != pdPASS) {
+      ESP_LOGW(TAG, "Could not create render task, rendering in the main loop.");
+      this->render_task_handle_ = nullptr;
+      this->render_in_background_ = false;
+    }
+  }
+#endif
+}
+void DisplayBuffer::init_change_tracking_(uint32_t buffer_length, uint32_t segment_length) {
+  this->segment_length_ = segment_length;
+  this->segment_count_ = buffer_length / segment_length;
+  this->segment_hashes_ = new uint32_t[this->segment_count_];
+  if (this->segment_hashes_ == nullptr) {
+    ESP_LOGW(TAG, "Could not allocate change tracking, will always transfer the full buffer.");
+    this->segment_count_ = 0;
+    return;
+  }
+  this->invalidate_change_tracking_();
+}
+bool HOT DisplayBuffer::check_segment_changed_(uint32_t segment) {
+  if (this->segment_hashes_ == nullptr || segment >= this->segment_count_)
+    return true;
+
+  // FNV-1a
+  const uint8_t *data = this->buffer_ + segment * this->segment_length_;
+  uint32_t hash = 2166136261UL;
+  for (uint32_t i = 0; i < this->segment_length_; i++) {
+    hash ^= data[i];
+    hash *= 16777619UL;
+  }
+  if (segment == 0) {
+    // invalidating during an update (for example on a transfer error) applies to the next update
+    this->force_this_update_ = this->force_full_update_;
+    this->force_full_update_ = false;
+  }
+  const bool changed = this->force_this_update_ || this->segment_hashes_[segment] != hash;
+  this->segment_hashes_[segment] = hash;
+  return changed;
+}
+void DisplayBuffer::invalidate_change_tracking_() { this->force_full_update_ = true; }
+void DisplayBuffer::set_bytes_transferred_(uint32_t bytes) {
+  this->transfer_time_ = micros() - this->frame_ready_;
+  ESP_LOGV(TAG, "Frame rendered in %u us, transferred in %u us.", this->render_time_, this->transfer_time_);
+  this->bytes_transferred_ = bytes;
+  if (bytes == 0)
+    this->skipped_transfer_count_++;
+}
+uint32_t DisplayBuffer::get_bytes_transferred() const { return this->bytes_transferred_; }
+void DisplayBuffer::fill(int color) { this->fill_internal_(this->to_driver_color_(color)); }
 void DisplayBuffer::clear() { this->fill(COLOR_OFF); }
 int DisplayBuffer::get_width() {
   switch (this->rotation_) {
@@ -50,6 +109,18 @@ int DisplayBuffer::get_height() {
   }
 }
 void DisplayBuffer::set_rotation(DisplayRotation rotation) { this->rotation_ = rotation; }
+bool DisplayBuffer::supports_rgb_colors_() const { return false; }
+int HOT DisplayBuffer::to_driver_color_(int color) const {
+  if (!(color & COLOR_RGB_FLAG) || this->supports_rgb_colors_())
+    return color;
+  return get_color_luminance(color) > 127 ? COLOR_ON : COLOR_OFF;
+}
+void DisplayBuffer::fill_internal_(int color) {
+  const int width = this->get_width_internal();
+  const int height = this->get_height_internal();
+  for (int y = 0; y < height; y++)
+    this->draw_absolute_horizontal_line_internal(0, y, width, color);
+}
 void HOT DisplayBuffer::draw_pixel_at(int x, int y, int color) {
   switch (this->rotation_) {
     case DISPLAY_ROTATION_0_DEGREES:
@@ -67,7 +138,7 @@ void HOT DisplayBuffer::draw_pixel_at(int x, int y, int color) {
       y = this->get_height_internal() - y - 1;
       break;
   }
-  this->draw_absolute_pixel_internal(x, y, color);
+  this->draw_absolute_pixel_internal(x, y, this->to_driver_color_(color));
   feed_wdt();
 }
 void HOT DisplayBuffer::line(int x1, int y1, int x2, int y2, int color) {
@@ -91,14 +162,159 @@ void HOT DisplayBuffer::line(int x1, int y1, int x2, int y2, int color) {
   }
 }
 void HOT DisplayBuffer::horizontal_line(int x, int y, int width, int color) {
-  // Future: Could be made more efficient by manipulating buffer directly in certain rotations.
-  for (int i = x; i < x + width; i++)
-    this->draw_pixel_at(i, y, color);
+  if (y < 0 || y >= this->get_height())
+    return;
+  if (x < 0) {
+    width += x;
+    x = 0;
+  }
+  width = std::min(width, this->get_width() - x);
+  if (width <= 0)
+    return;
+  color = this->to_driver_color_(color);
+
+  // a horizontal line is a vertical run in the buffer when rotated by 90 or 270 degrees
+  switch (this->rotation_) {
+    case DISPLAY_ROTATION_0_DEGREES:
+      this->draw_absolute_horizontal_line_internal(x, y, width, color);
+      break;
+    case DISPLAY_ROTATION_90_DEGREES:
+      this->draw_absolute_vertical_line_internal(this->get_width_internal() - y - 1, x, width, color);
+      break;
+    case DISPLAY_ROTATION_180_DEGREES:
+      this->draw_absolute_horizontal_line_internal(this->get_width_internal() - x - width,
+                                                   this->get_height_internal() - y - 1, width, color);
+      break;
+    case DISPLAY_ROTATION_270_DEGREES:
+      this->draw_absolute_vertical_line_internal(y, this->get_height_internal() - x - width, width, color);
+      break;
+  }
+  feed_wdt();
 }
 void HOT DisplayBuffer::vertical_line(int x, int y, int height, int color) {
-  // Future: Could be made more efficient by manipulating buffer directly in certain rotations.
+  if (x < 0 || x >= this->get_width())
+    return;
+  if (y < 0) {
+    height += y;
+    y = 0;
+  }
+  height = std::min(height, this->get_height() - y);
+  if (height <= 0)
+    return;
+  color = this->to_driver_color_(color);
+
+  switch (this->rotation_) {
+    case DISPLAY_ROTATION_0_DEGREES:
+      this->draw_absolute_vertical_line_internal(x, y, height, color);
+      break;
+    case DISPLAY_ROTATION_90_DEGREES:
+      this->draw_absolute_horizontal_line_internal(this->get_width_internal() - y - height, x, height, color);
+      break;
+    case DISPLAY_ROTATION_180_DEGREES:
+      this->draw_absolute_vertical_line_internal(this->get_width_internal() - x - 1,
+                                                 this->get_height_internal() - y - height, height, color);
+      break;
+    case DISPLAY_ROTATION_270_DEGREES:
+      this->draw_absolute_horizontal_line_internal(y, this->get_height_internal() - x - 1, height, color);
+      break;
+  }
+  feed_wdt();
+}
+void HOT DisplayBuffer::draw_absolute_horizontal_line_internal(int x, int y, int width, int color) {
+  for (int i = x; i < x + width; i++)
+    this->draw_absolute_pixel_internal(i, y, color);
+}
+void HOT DisplayBuffer::draw_absolute_vertical_line_internal(int x, int y, int height, int color) {
   for (int i = y; i < y + height; i++)
-    this->draw_pixel_at(x, i, color);
+    this->draw_absolute_pixel_internal(x, i, color);
+}
+bool DisplayBuffer::draw_absolute_bitmap_internal(int x, int y, const uint8_t *data, int width, int height, int color,
+                                                  bool draw_background) {
+  return false;
+}
+void HOT DisplayBuffer::draw_bitmap_(int x, int y, const uint8_t *data, int width, int height, int color,
+                                     bool draw_background, BitmapEncoding encoding) {
+  color = this->to_driver_color_(color);
+  if (encoding == BITMAP_ENCODING_RLE) {
+    // the pending run of equal pixels in the current row
+    int row = 0;
+    int col = 0;
+    int run_start = 0;
+    bool run_set = false;
+    auto flush = [&]() {
+      if (col > run_start) {
+        if (run_set)
+          this->horizontal_line(x + run_start, y + row, col - run_start, color);
+        else if (draw_background)
+          this->horizontal_line(x + run_start, y + row, col - run_start, COLOR_OFF);
+      }
+      run_start = col;
+    };
+    auto push = [&](bool set, int count) {
+      while (count > 0 && row < height) {
+        if (set != run_set) {
+          flush();
+          run_set = set;
+        }
+        const int n = std::min(count, width - col);
+        col += n;
+        count -= n;
+        if (col == width) {
+          flush();
+          row++;
+          col = 0;
+          run_start = 0;
+        }
+      }
+    };
+
+    const uint8_t *pos = data;
+    while (row < height) {
+      const uint8_t token = pgm_read_byte(pos++);
+      if (token & 0x80) {
+        for (uint8_t bit = 0; bit < 7; bit++)
+          push(token & (0x40 >> bit), 1);
+      } else {
+        push(token & 0x40, (token & 0x3F) + 1);
+      }
+    }
+    return;
+  }
+
+  if (this->rotation_ == DISPLAY_ROTATION_0_DEGREES && x >= 0 && y >= 0 && x + width <= this->get_width_internal() &&
+      y + height <= this->get_height_internal() &&
+      this->draw_absolute_bitmap_internal(x, y, data, width, height, color, draw_background)) {
+    feed_wdt();
+    return;
+  }
+
+  const uint32_t stride = (width + 7u) / 8u;
+  for (int row = 0; row < height; row++) {
+    const uint8_t *row_data = data + row * stride;
+    // draw the bitmap as runs of equal pixels, bytes that only continue the current run are skipped as a whole
+    int run_start = 0;
+    bool run_set = false;
+    for (int byte_x = 0; byte_x < width; byte_x += 8) {
+      const uint8_t byte = pgm_read_byte(row_data + byte_x / 8);
+      if (byte == (run_set ? 0xFF : 0x00))
+        continue;
+      for (int bit = 0; bit < 8 && byte_x + bit < width; bit++) {
+        const bool set = byte & (0x80 >> bit);
+        if (set == run_set)
+          continue;
+        if (run_set)
+          this->horizontal_line(x + run_start, y + row, byte_x + bit - run_start, color);
+        else if (draw_background)
+          this->horizontal_line(x + run_start, y + row, byte_x + bit - run_start, COLOR_OFF);
+        run_start = byte_x + bit;
+        run_set = set;
+      }
+    }
+    if (run_set)
+      this->horizontal_line(x + run_start, y + row, width - run_start, color);
+    else if (draw_background)
+      this->horizontal_line(x + run_start, y + row, width - run_start, COLOR_OFF);
+  }
 }
 void DisplayBuffer::rectangle(int x1, int y1, int width, int height, int color) {
   this->horizontal_line(x1, y1, width, color);
@@ -107,7 +323,6 @@ void DisplayBuffer::rectangle(int x1, int y1, int width, int height, int color)
   this->vertical_line(x1 + width - 1, y1, height, color);
 }
 void DisplayBuffer::filled_rectangle(int x1, int y1, int width, int height, int color) {
-  // Future: Use vertical_line and horizontal_line methods depending on rotation to reduce memory accesses.
   for (int i = y1; i < y1 + height; i++) {
     this->horizontal_line(x1, i, width, color);
   }
@@ -165,7 +380,14 @@ void DisplayBuffer::filled_circle(int center_x, int center_y, int radius, int co
 void DisplayBuffer::print(int x, int y, Font *font, int color, TextAlign align, const char *text) {
   int x_start, y_start;
   int width, height;
-  this->get_text_bounds(x, y, text, font, align, &x_start, &y_start, &width, &height);
+  if (align == TextAlign::TOP_LEFT) {
+    // nothing to align, so there's no need to measure the text first
+    x_start = x;
+    y_start = y;
+    height = font->get_height();
+  } else {
+    this->get_text_bounds(x, y, text, font, align, &x_start, &y_start, &width, &height);
+  }
 
   int i = 0;
   int x_at = x_start;
@@ -174,12 +396,10 @@ void DisplayBuffer::print(int x, int y, Font *font, int color, TextAlign align,
     int glyph_n = font->match_next_glyph(text + i, &match_length);
     if (glyph_n < 0) {
       // Unknown char, skip
-      ESP_LOGW(TAG, "Encountered character without representation in font: '%c'", text[i]);
+      this->log_missing_glyph_(text[i]);
       if (!font->get_glyphs().empty()) {
         uint8_t glyph_width = font->get_glyphs()[0].width_;
-        for (int glyph_x = 0; glyph_x < glyph_width; glyph_x++)
-          for (int glyph_y = 0; glyph_y < height; glyph_y++)
-            this->draw_pixel_at(glyph_x + x_at, glyph_y + y_start, color);
+        this->filled_rectangle(x_at, y_start, glyph_width, height, color);
         x_at += glyph_width;
       }
 
@@ -188,16 +408,8 @@ void DisplayBuffer::print(int x, int y, Font *font, int color, TextAlign align,
     }
 
     const Glyph &glyph = font->get_glyphs()[glyph_n];
-    int scan_x1, scan_y1, scan_width, scan_height;
-    glyph.scan_area(&scan_x1, &scan_y1, &scan_width, &scan_height);
-
-    for (int glyph_x = scan_x1; glyph_x < scan_x1 + scan_width; glyph_x++) {
-      for (int glyph_y = scan_y1; glyph_y < scan_y1 + scan_height; glyph_y++) {
-        if (glyph.get_pixel(glyph_x, glyph_y)) {
-          this->draw_pixel_at(glyph_x + x_at, glyph_y + y_start, color);
-        }
-      }
-    }
+    this->draw_bitmap_(x_at + glyph.offset_x_, y_start + glyph.offset_y_, glyph.data_, glyph.width_, glyph.height_,
+                       color, false, glyph.encoding_);
 
     x_at += glyph.width_ + glyph.offset_x_;
 
@@ -211,11 +423,7 @@ void DisplayBuffer::vprintf_(int x, int y, Font *font, int color, TextAlign alig
     this->print(x, y, font, color, align, buffer);
 }
 void DisplayBuffer::image(int x, int y, Image *image) {
-  for (int img_x = 0; img_x < image->get_width(); img_x++) {
-    for (int img_y = 0; img_y < image->get_height(); img_y++) {
-      this->draw_pixel_at(x + img_x, y + img_y, image->get_pixel(img_x, img_y) ? COLOR_ON : COLOR_OFF);
-    }
-  }
+  this->draw_bitmap_(x, y, image->data_start_, image->width_, image->height_, COLOR_ON, true, image->encoding_);
 }
 void DisplayBuffer::get_text_bounds(int x, int y, const char *text, Font *font, TextAlign align, int *x1, int *y1,
                                     int *width, int *height) {
@@ -301,17 +509,172 @@ void DisplayBuffer::set_pages(std::vector<DisplayPage *> pages) {
   pages[pages.size() - 1]->set_next(pages[0]);
   this->show_page(pages[0]);
 }
-void DisplayBuffer::show_page(DisplayPage *page) { this->page_ = page; }
+void DisplayBuffer::show_page(DisplayPage *page) {
+  this->page_ = page;
+  this->mark_dirty();
+}
 void DisplayBuffer::show_next_page() { this->page_->show_next(); }
 void DisplayBuffer::show_prev_page() { this->page_->show_prev(); }
-void DisplayBuffer::do_update_() {
+bool DisplayBuffer::do_update_() {
+#ifdef ARDUINO_ARCH_ESP32
+  if (this->rendering_) {
+    // the last frame isn't finished yet
+    this->skipped_render_count_++;
+    return false;
+  }
+#endif
+  this->dirty_ = false;
+  this->last_render_ = millis();
+  this->render_page_ = this->page_;
+  this->take_snapshot_();
+#ifdef ARDUINO_ARCH_ESP32
+  if (this->render_task_handle_ != nullptr) {
+    this->rendering_ = true;
+    xTaskNotifyGive(this->render_task_handle_);
+    return false;
+  }
+#endif
+  this->render_();
+  this->frame_ready_ = micros();
+  return true;
+}
+bool DisplayBuffer::check_render_done_() {
+#ifdef ARDUINO_ARCH_ESP32
+  if (!this->rendering_ || xSemaphoreTake(this->render_done_, 0) != pdTRUE)
+    return false;
+  this->rendering_ = false;
+  this->frame_ready_ = micros();
+  this->log_render_warnings_();
+  return true;
+#else
+  return false;
+#endif
+}
+void DisplayBuffer::render_() {
+  this->render_count_++;
+  const uint32_t start = micros();
   this->clear();
-  if (this->page_ != nullptr) {
-    this->page_->get_writer()(*this);
+  if (this->render_page_ != nullptr) {
+    this->render_page_->get_writer()(*this);
   } else if (this->writer_.has_value()) {
     (*this->writer_)(*this);
   }
+  this->render_time_ = micros() - start;
+}
+void DisplayBuffer::log_missing_glyph_(char c) {
+#ifdef ARDUINO_ARCH_ESP32
+  if (this->render_task_handle_ != nullptr && xTaskGetCurrentTaskHandle() == this->render_task_handle_) {
+    // the main loop only reads these after the render task finished the frame
+    this->missing_glyph_count_++;
+    if (this->missing_glyphs_.size() < 16 && this->missing_glyphs_.find(c) == std::string::npos)
+      this->missing_glyphs_ += c;
+    return;
+  }
+#endif
+  ESP_LOGW(TAG, "Encountered character without representation in font: '%c'", c);
+}
+#ifdef ARDUINO_ARCH_ESP32
+void DisplayBuffer::log_render_warnings_() {
+  if (this->missing_glyph_count_ == 0)
+    return;
+  ESP_LOGW(TAG, "Encountered %u characters without representation in font: '%s'", this->missing_glyph_count_,
+           this->missing_glyphs_.c_str());
+  this->missing_glyph_count_ = 0;
+  this->missing_glyphs_.clear();
+}
+void DisplayBuffer::render_task_(void *params) {
+  auto *display = reinterpret_cast<DisplayBuffer *>(params);
+  while (true) {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    display->render_();
+    xSemaphoreGive(display->render_done_);
+  }
+}
+void DisplayBuffer::set_render_in_background(bool render_in_background) {
+  this->render_in_background_ = render_in_background;
+}
+void DisplayBuffer::set_render_task_stack_size(uint32_t render_task_stack_size) {
+  this->render_task_stack_size_ = render_task_stack_size;
+}
+#endif
+bool DisplayBuffer::is_rendering_in_background() const {
+#ifdef ARDUINO_ARCH_ESP32
+  return this->render_task_handle_ != nullptr;
+#else
+  return false;
+#endif
+}
+void DisplayBuffer::take_snapshot_() {
+#ifdef USE_SENSOR
+  for (auto &state : this->sensor_states_)
+    state.second = state.first->state;
+#endif
+#ifdef USE_BINARY_SENSOR
+  for (auto &state : this->binary_sensor_states_)
+    state.second = state.first->state;
+#endif
+#ifdef USE_TEXT_SENSOR
+  for (auto &state : this->text_sensor_states_)
+    state.second = state.first->state;
+#endif
+}
+uint32_t DisplayBuffer::get_render_time() const { return this->render_time_; }
+uint32_t DisplayBuffer::get_transfer_time() const { return this->transfer_time_; }
+bool DisplayBuffer::should_render_() {
+  if (!this->redraw_on_change_ || this->dirty_)
+    return true;
+  if (this->refresh_interval_ != 0 && millis() - this->last_render_ >= this->refresh_interval_)
+    return true;
+  this->skipped_render_count_++;
+  return false;
+}
+void DisplayBuffer::set_redraw_on_change(uint32_t refresh_interval) {
+  this->redraw_on_change_ = true;
+  this->refresh_interval_ = refresh_interval;
+}
+void DisplayBuffer::mark_dirty() { this->dirty_ = true; }
+#ifdef USE_SENSOR
+void DisplayBuffer::add_dependency(sensor::Sensor *sensor) {
+  sensor->add_on_state_callback([this](float) { this->mark_dirty(); });
+  this->sensor_states_.emplace_back(sensor, sensor->state);
+}
+float DisplayBuffer::get_state(sensor::Sensor *sensor) const {
+  for (auto &state : this->sensor_states_) {
+    if (state.first == sensor)
+      return state.second;
+  }
+  return sensor->state;
 }
+#endif
+#ifdef USE_BINARY_SENSOR
+void DisplayBuffer::add_dependency(binary_sensor::BinarySensor *binary_sensor) {
+  binary_sensor->add_on_state_callback([this](bool) { this->mark_dirty(); });
+  this->binary_sensor_states_.emplace_back(binary_sensor, binary_sensor->state);
+}
+bool DisplayBuffer::get_state(binary_sensor::BinarySensor *binary_sensor) const {
+  for (auto &state : this->binary_sensor_states_) {
+    if (state.first == binary_sensor)
+      return state.second;
+  }
+  return binary_sensor->state;
+}
+#endif
+#ifdef USE_TEXT_SENSOR
+void DisplayBuffer::add_dependency(text_sensor::TextSensor *text_sensor) {
+  text_sensor->add_on_state_callback([this](std::string) { this->mark_dirty(); });
+  this->text_sensor_states_.emplace_back(text_sensor, text_sensor->state);
+}
+const std::string &DisplayBuffer::get_state(text_sensor::TextSensor *text_sensor) const {
+  for (auto &state : this->text_sensor_states_) {
+    if (state.first == text_sensor)
+      return state.second;
+  }
+  return text_sensor->state;
+}
+#endif
+uint32_t DisplayBuffer::get_render_count() const { return this->render_count_; }
+uint32_t DisplayBuffer::get_skipped_render_count() const { return this->skipped_render_count_; }
+uint32_t DisplayBuffer::get_skipped_transfer_count() const { return this->skipped_transfer_count_; }
 #ifdef USE_TIME
 void DisplayBuffer::strftime(int x, int y, Font *font, int color, TextAlign align, const char *format,
                              time::ESPTime time) {
@@ -331,22 +694,46 @@ void DisplayBuffer::strftime(int x, int y, Font *font, const char *format, time:
 }
 #endif
 
+/// Get a pixel of a bitmap, see BitmapEncoding. x and y have to be inside the bitmap.
+static bool get_bitmap_pixel(const uint8_t *data, BitmapEncoding encoding, int width, int x, int y) {
+  if (encoding == BITMAP_ENCODING_RAW) {
+    const uint32_t width_8 = ((width + 7u) / 8u) * 8u;
+    const uint32_t pos = x + y * width_8;
+    return pgm_read_byte(data + (pos / 8u)) & (0x80 >> (pos % 8u));
+  }
+
+  // RLE can only be decoded from the start
+  const uint32_t pos = x + y * width;
+  uint32_t at = 0;
+  while (true) {
+    const uint8_t token = pgm_read_byte(data++);
+    if (token & 0x80) {
+      if (pos < at + 7)
+        return token & (0x40 >> (pos - at));
+      at += 7;
+    } else {
+      at += (token & 0x3F) + 1;
+      if (pos < at)
+        return token & 0x40;
+    }
+  }
+}
+
 Glyph::Glyph(const char *a_char, const uint8_t *data_start, uint32_t offset, int offset_x, int offset_y, int width,
-             int height)
+             int height, BitmapEncoding encoding)
     : char_(a_char),
       data_(data_start + offset),
       offset_x_(offset_x),
       offset_y_(offset_y),
       width_(width),
-      height_(height) {}
+      height_(height),
+      encoding_(encoding) {}
 bool Glyph::get_pixel(int x, int y) const {
   const int x_data = x - this->offset_x_;
   const int y_data = y - this->offset_y_;
   if (x_data < 0 || x_data >= this->width_ || y_data < 0 || y_data >= this->height_)
     return false;
-  const uint32_t width_8 = ((this->width_ + 7u) / 8u) * 8u;
-  const uint32_t pos = x_data + y_data * width_8;
-  return pgm_read_byte(this->data_ + (pos / 8u)) & (0x80 >> (pos % 8u));
+  return get_bitmap_pixel(this->data_, this->encoding_, this->width_, x_data, y_data);
 }
 const char *Glyph::get_char() const { return this->char_; }
 bool Glyph::compare_to(const char *str) const {
@@ -382,6 +769,12 @@ void Glyph::scan_area(int *x1, int *y1, int *width, int *height) const {
   *height = this->height_;
 }
 int Font::match_next_glyph(const char *str, int *match_length) {
+  const auto c = uint8_t(str[0]);
+  if (c < 0x80 && this->ascii_index_[c] >= 0) {
+    *match_length = 1;
+    return this->ascii_index_[c];
+  }
+
   int lo = 0;
   int hi = this->glyphs_.size() - 1;
   while (lo != hi) {
@@ -428,20 +821,29 @@ void Font::measure(const char *str, int *width, int *x_offset, int *baseline, in
   *width = x - min_x;
 }
 const std::vector<Glyph> &Font::get_glyphs() const { return this->glyphs_; }
+int Font::get_baseline() const { return this->baseline_; }
+int Font::get_height() const { return this->bottom_; }
 Font::Font(std::vector<Glyph> &&glyphs, int baseline, int bottom)
-    : glyphs_(std::move(glyphs)), baseline_(baseline), bottom_(bottom) {}
+    : glyphs_(std::move(glyphs)), baseline_(baseline), bottom_(bottom) {
+  // ASCII characters are always encoded as a single byte in UTF-8, so they can be looked up directly
+  for (auto &index : this->ascii_index_)
+    index = -1;
+  for (size_t i = 0; i < this->glyphs_.size(); i++) {
+    const char *a_char = this->glyphs_[i].char_;
+    if (a_char[0] != '\0' && uint8_t(a_char[0]) < 0x80 && a_char[1] == '\0')
+      this->ascii_index_[uint8_t(a_char[0])] = i;
+  }
+}
 
 bool Image::get_pixel(int x, int y) const {
   if (x < 0 || x >= this->width_ || y < 0 || y >= this->height_)
     return false;
-  const uint32_t width_8 = ((this->width_ + 7u) / 8u) * 8u;
-  const uint32_t pos = x + y * width_8;
-  return pgm_read_byte(this->data_start_ + (pos / 8u)) & (0x80 >> (pos % 8u));
+  return get_bitmap_pixel(this->data_start_, this->encoding_, this->width_, x, y);
 }
 int Image::get_width() const { return this->width_; }
 int Image::get_height() const { return this->height_; }
-Image::Image(const uint8_t *data_start, int width, int height)
-    : width_(width), height_(height), data_start_(data_start) {}
+Image::Image(const uint8_t *data_start, int width, int height, BitmapEncoding encoding)
+    : width_(width), height_(height), data_start_(data_start), encoding_(encoding) {}
 
 DisplayPage::DisplayPage(const display_writer_t &writer) : writer_(writer) {}
 void DisplayPage::show() { this->parent_->show_page(this); }
@@ -451,6 +853,25 @@ void DisplayPage::set_parent(DisplayBuffer *parent) { this->parent_ = parent; }
 void DisplayPage::set_prev(DisplayPage *prev) { this->prev_ = prev; }
 void DisplayPage::set_next(DisplayPage *next) { this->next_ = next; }
 const display_writer_t &DisplayPage::get_writer() const { return this->writer_; }
+void DisplayPage::mark_dirty_() {
+  if (this->parent_ != nullptr && this->parent_->page_ == this)
+    this->parent_->mark_dirty();
+}
+#ifdef USE_SENSOR
+void DisplayPage::add_dependency(sensor::Sensor *sensor) {
+  sensor->add_on_state_callback([this](float) { this->mark_dirty_(); });
+}
+#endif
+#ifdef USE_BINARY_SENSOR
+void DisplayPage::add_dependency(binary_sensor::BinarySensor *binary_sensor) {
+  binary_sensor->add_on_state_callback([this](bool) { this->mark_dirty_(); });
+}
+#endif
+#ifdef USE_TEXT_SENSOR
+void DisplayPage::add_dependency(text_sensor::TextSensor *text_sensor) {
+  text_sensor->add_on_state_callback([this](std::string) { this->mark_dirty_(); });
+}
+#endif
 
 }  // namespace display
 
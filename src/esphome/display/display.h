@@ -8,6 +8,15 @@
 #include "esphome/helpers.h"
 #include "esphome/automation.h"
 #include "esphome/time/rtc_component.h"
+#ifdef USE_SENSOR
+#include "esphome/sensor/sensor.h"
+#endif
+#ifdef USE_BINARY_SENSOR
+#include "esphome/binary_sensor/binary_sensor.h"
+#endif
+#ifdef USE_TEXT_SENSOR
+#include "esphome/text_sensor/text_sensor.h"
+#endif
 #include <functional>
 #include <vector>
 
@@ -69,9 +78,25 @@ enum class TextAlign {
 extern const uint8_t COLOR_OFF;
 /// Turn the pixel ON.
 extern const uint8_t COLOR_ON;
+/// Set in colors created with color_rgb().
+static const int COLOR_RGB_FLAG = 0x01000000;
+
+/** Create a color from 8 bit red, green and blue values, for displays with gray levels or colors.
+ *
+ * Monochrome displays turn the pixel ON if the color is brighter than 50%.
+ */
+int color_rgb(uint8_t red, uint8_t green, uint8_t blue);
 
 namespace display {
 
+/// Get the brightness (0-255) of a color created with color_rgb().
+inline uint8_t get_color_luminance(int color) {
+  const uint32_t red = (color >> 16) & 0xFF;
+  const uint32_t green = (color >> 8) & 0xFF;
+  const uint32_t blue = color & 0xFF;
+  return (red * 77 + green * 150 + blue * 29) >> 8;
+}
+
 enum DisplayRotation {
   DISPLAY_ROTATION_0_DEGREES = 0,
   DISPLAY_ROTATION_90_DEGREES = 90,
@@ -79,6 +104,20 @@ enum DisplayRotation {
   DISPLAY_ROTATION_270_DEGREES = 270,
 };
 
+/** How the pixels of an Image or Glyph are stored in flash.
+ *
+ * RAW: 1bpp, MSB first, each row padded to whole bytes.
+ *
+ * RLE: a stream of bytes over all pixels in row order, without padding. A byte 0b0vnnnnnn is a run of n + 1 pixels
+ * with value v, a byte 0b1ppppppp holds the next 7 pixels literally (MSB first). Large images with uniform areas
+ * typically shrink to a fraction of the RAW size, noisy ones grow by at most 1/7 (the code generator should then
+ * use RAW).
+ */
+enum BitmapEncoding {
+  BITMAP_ENCODING_RAW = 0,
+  BITMAP_ENCODING_RLE,
+};
+
 class Font;
 class Image;
 class DisplayBuffer;
@@ -91,12 +130,18 @@ using display_writer_t = std::function<void(DisplayBuffer &)>;
     ESP_LOGCONFIG(TAG, prefix type); \
     ESP_LOGCONFIG(TAG, prefix "  Rotations: %d °", obj->rotation_); \
     ESP_LOGCONFIG(TAG, prefix "  Dimensions: %dpx x %dpx", obj->get_width(), obj->get_height()); \
+    if (obj->redraw_on_change_) { \
+      ESP_LOGCONFIG(TAG, prefix "  Redraw On Change: YES (refresh interval %u ms)", obj->refresh_interval_); \
+    } \
+    if (obj->is_rendering_in_background()) { \
+      ESP_LOGCONFIG(TAG, prefix "  Render In Background: YES"); \
+    } \
   }
 
 class DisplayBuffer {
  public:
   /// Fill the entire screen with the given color.
-  virtual void fill(int color);
+  void fill(int color);
   /// Clear the entire screen by filling it with OFF pixels.
   void clear();
 
@@ -295,23 +340,223 @@ class DisplayBuffer {
   /// Internal method to set the display rotation with.
   void set_rotation(DisplayRotation rotation);
 
+  /// Get the number of display data bytes the last update sent, without commands. 0 if nothing changed.
+  uint32_t get_bytes_transferred() const;
+
+  /// Get the time the last update took to clear the buffer and run the writer in µs.
+  uint32_t get_render_time() const;
+
+  /// Get the time the last update took to send the rendered buffer to the display in µs.
+  uint32_t get_transfer_time() const;
+
+#ifdef ARDUINO_ARCH_ESP32
+  /** Render on a separate FreeRTOS task on the other core, so that the main loop keeps running while the writer
+   * draws.
+   *
+   * An update then only starts rendering and the frame is transferred in the first loop() after rendering finished.
+   * Updates while a frame is still being rendered are skipped. Supported by the SSD1306 and Waveshare e-paper
+   * displays, must be called before setup.
+   *
+   * The writer runs concurrently to the main loop, so it should read the states of entities with get_state() (see
+   * add_dependency()), not directly. It must not log either: logging isn't safe outside the main loop (the log
+   * callbacks publish over MQTT and the native API). Warnings of the drawing methods, like missing glyphs, are
+   * collected and logged from the main loop once the frame is done.
+   */
+  void set_render_in_background(bool render_in_background);
+  /// Set the stack size of the render task in bytes, defaults to 8192 like the Arduino loop task. Call before setup.
+  void set_render_task_stack_size(uint32_t render_task_stack_size);
+#endif
+  /// Whether the writer runs on a separate task, see set_render_in_background().
+  bool is_rendering_in_background() const;
+
+  /** Only redraw the display when something shown on it changed.
+   *
+   * An update then only renders if mark_dirty() was called since the last render (directly or by a dependency
+   * publishing a new state), the page changed or refresh_interval ms passed. Drivers with change tracking
+   * additionally skip the transfer if the rendered frame is the same as the last one.
+   *
+   * @param refresh_interval Redraw at least this often in ms even without changes, 0 for never.
+   */
+  void set_redraw_on_change(uint32_t refresh_interval);
+
+  /// Redraw on the next update, see set_redraw_on_change().
+  void mark_dirty();
+
+#ifdef USE_SENSOR
+  /** Redraw when this sensor publishes a new state, see set_redraw_on_change().
+   *
+   * Its state is also copied at the start of every frame, see get_state().
+   */
+  void add_dependency(sensor::Sensor *sensor);
+  /// Get the state of a sensor as it was when the frame started rendering if it's a dependency, else its current state.
+  float get_state(sensor::Sensor *sensor) const;
+#endif
+#ifdef USE_BINARY_SENSOR
+  /// Redraw when this binary sensor publishes a new state, see set_redraw_on_change(). Copied like sensor states.
+  void add_dependency(binary_sensor::BinarySensor *binary_sensor);
+  /// Get the state of a binary sensor as it was when the frame started rendering, see get_state(sensor::Sensor *).
+  bool get_state(binary_sensor::BinarySensor *binary_sensor) const;
+#endif
+#ifdef USE_TEXT_SENSOR
+  /// Redraw when this text sensor publishes a new state, see set_redraw_on_change(). Copied like sensor states.
+  void add_dependency(text_sensor::TextSensor *text_sensor);
+  /// Get the state of a text sensor as it was when the frame started rendering, see get_state(sensor::Sensor *).
+  const std::string &get_state(text_sensor::TextSensor *text_sensor) const;
+#endif
+
+  /// Get the number of times the buffer was rendered.
+  uint32_t get_render_count() const;
+  /// Get the number of updates that didn't render because nothing changed.
+  uint32_t get_skipped_render_count() const;
+  /// Get the number of updates that rendered, but didn't need to transfer anything to the display.
+  uint32_t get_skipped_transfer_count() const;
+
  protected:
+  friend DisplayPage;
+
   void vprintf_(int x, int y, Font *font, int color, TextAlign align, const char *format, va_list arg);
 
+  /** Whether the driver draws colors created with color_rgb() itself.
+   *
+   * Otherwise they are converted to COLOR_ON (brighter than 50%) or COLOR_OFF before they are passed to the
+   * drawing methods of the driver, which then only get these two colors.
+   */
+  virtual bool supports_rgb_colors_() const;
+
+  /// Convert a color for the driver, see supports_rgb_colors_().
+  int to_driver_color_(int color) const;
+
+  /// Fill the entire buffer, drivers should override this to set whole bytes of their buffer.
+  virtual void fill_internal_(int color);
+
   virtual void draw_absolute_pixel_internal(int x, int y, int color) = 0;
 
+  /** Draw a run of width pixels to the right of the absolute (not rotated) position x, y.
+   *
+   * The run is already clipped to the display. The default implementation draws each pixel with
+   * draw_absolute_pixel_internal(), drivers should override this to write whole bytes of their buffer.
+   */
+  virtual void draw_absolute_horizontal_line_internal(int x, int y, int width, int color);
+
+  /// Like draw_absolute_horizontal_line_internal(), but draw a run of height pixels below x, y.
+  virtual void draw_absolute_vertical_line_internal(int x, int y, int height, int color);
+
+  /** Draw a 1bpp bitmap (see draw_bitmap_()) at the absolute position x, y.
+   *
+   * Only called without rotation and if the bitmap is completely inside the display, so drivers can copy whole
+   * bytes of the bitmap into their buffer.
+   *
+   * @return false if the driver has no fast path, then the bitmap is drawn as horizontal lines.
+   */
+  virtual bool draw_absolute_bitmap_internal(int x, int y, const uint8_t *data, int width, int height, int color,
+                                             bool draw_background);
+
+  /** Draw a 1bpp bitmap in PROGMEM (MSB first, rows padded to whole bytes).
+   *
+   * Set pixels are drawn with color, clear pixels with COLOR_OFF if draw_background is true. RLE bitmaps are decoded
+   * while drawing, without a buffer for the decompressed data.
+   */
+  void draw_bitmap_(int x, int y, const uint8_t *data, int width, int height, int color, bool draw_background,
+                    BitmapEncoding encoding = BITMAP_ENCODING_RAW);
+
   virtual int get_height_internal() = 0;
 
   virtual int get_width_internal() = 0;
 
   void init_internal_(uint32_t buffer_length);
 
-  void do_update_();
+  /// Start the render task if set_render_in_background() was enabled, for drivers that support it.
+  void init_render_task_();
+
+  /** Render a frame: clear the buffer and run the writer.
+   *
+   * @return true if the frame was rendered and can be transferred now, false if it's rendered in the background
+   * (then check_render_done_() returns true once it's finished).
+   */
+  bool do_update_();
+
+  /// Whether a frame rendered in the background is finished and can be transferred, call in loop().
+  bool check_render_done_();
+
+  /// Whether the update should render the buffer, see set_redraw_on_change().
+  bool should_render_();
+
+  /** Enable change tracking for drivers that can transfer parts of the buffer.
+   *
+   * The buffer is split into segments of segment_length bytes (for example a page slice of an SSD1306 or a row of an
+   * e-paper display) and for each segment a hash of the transmitted contents is remembered, so that only the
+   * segments that differ need to be sent again. Needs 4 bytes of RAM per segment instead of a full copy of the
+   * buffer. Must be called after init_internal_().
+   */
+  void init_change_tracking_(uint32_t buffer_length, uint32_t segment_length);
+
+  /** Check whether the segment changed since it was last transmitted and remember its current contents as transmitted.
+   *
+   * Drivers have to check all segments in order on every update. Always true without change tracking and on the
+   * first update after invalidate_change_tracking_().
+   */
+  bool check_segment_changed_(uint32_t segment);
+
+  /// Force the next update to transmit every segment, for example after the display was reset or a transfer failed.
+  void invalidate_change_tracking_();
+
+  /// Set the number of bytes the update sent to the display (see get_bytes_transferred()), at the end of the transfer.
+  void set_bytes_transferred_(uint32_t bytes);
+
+  /// Copy the states of the dependencies for get_state().
+  void take_snapshot_();
+  void render_();
+  /// Log that text contains a character the font doesn't have, deferred to the main loop on the render task.
+  void log_missing_glyph_(char c);
+#ifdef ARDUINO_ARCH_ESP32
+  static void render_task_(void *params);
+  /// Log the warnings collected while rendering in the background, from the main loop.
+  void log_render_warnings_();
+#endif
 
   uint8_t *buffer_{nullptr};
+  uint32_t *segment_hashes_{nullptr};
+  uint32_t segment_length_{0};
+  uint32_t segment_count_{0};
+  bool force_full_update_{true};
+  bool force_this_update_{true};
+  uint32_t bytes_transferred_{0};
+  uint32_t render_time_{0};
+  uint32_t transfer_time_{0};
+  /// When the last frame was ready to be transferred (micros()).
+  uint32_t frame_ready_{0};
+  bool redraw_on_change_{false};
+  uint32_t refresh_interval_{0};
+  bool dirty_{true};
+  uint32_t last_render_{0};
+  uint32_t render_count_{0};
+  uint32_t skipped_render_count_{0};
+  uint32_t skipped_transfer_count_{0};
   DisplayRotation rotation_{DISPLAY_ROTATION_0_DEGREES};
   optional<display_writer_t> writer_{};
   DisplayPage *page_{nullptr};
+  /// The page that is being rendered, page_ can change while rendering in the background.
+  DisplayPage *render_page_{nullptr};
+#ifdef USE_SENSOR
+  std::vector<std::pair<sensor::Sensor *, float>> sensor_states_;
+#endif
+#ifdef USE_BINARY_SENSOR
+  std::vector<std::pair<binary_sensor::BinarySensor *, bool>> binary_sensor_states_;
+#endif
+#ifdef USE_TEXT_SENSOR
+  std::vector<std::pair<text_sensor::TextSensor *, std::string>> text_sensor_states_;
+#endif
+#ifdef ARDUINO_ARCH_ESP32
+  bool render_in_background_{false};
+  uint32_t render_task_stack_size_{8192};
+  TaskHandle_t render_task_handle_{nullptr};
+  SemaphoreHandle_t render_done_{nullptr};
+  /// Whether the render task is working on a frame, only accessed from the main loop.
+  bool rendering_{false};
+  /// The characters without glyph found by the render task, logged by log_render_warnings_().
+  std::string missing_glyphs_;
+  uint32_t missing_glyph_count_{0};
+#endif
 };
 
 class DisplayPage {
@@ -325,8 +570,23 @@ class DisplayPage {
   void set_next(DisplayPage *next);
   const display_writer_t &get_writer() const;
 
+#ifdef USE_SENSOR
+  /// Redraw when this sensor publishes a new state while the page is shown, see DisplayBuffer::set_redraw_on_change().
+  void add_dependency(sensor::Sensor *sensor);
+#endif
+#ifdef USE_BINARY_SENSOR
+  /// Redraw when this binary sensor publishes a new state while the page is shown.
+  void add_dependency(binary_sensor::BinarySensor *binary_sensor);
+#endif
+#ifdef USE_TEXT_SENSOR
+  /// Redraw when this text sensor publishes a new state while the page is shown.
+  void add_dependency(text_sensor::TextSensor *text_sensor);
+#endif
+
  protected:
-  DisplayBuffer *parent_;
+  void mark_dirty_();
+
+  DisplayBuffer *parent_{nullptr};
   display_writer_t writer_;
   DisplayPage *prev_{nullptr};
   DisplayPage *next_{nullptr};
@@ -335,7 +595,7 @@ class DisplayPage {
 class Glyph {
  public:
   Glyph(const char *a_char, const uint8_t *data_start, uint32_t offset, int offset_x, int offset_y, int width,
-        int height);
+        int height, BitmapEncoding encoding = BITMAP_ENCODING_RAW);
 
   bool get_pixel(int x, int y) const;
 
@@ -357,6 +617,7 @@ class Glyph {
   int offset_y_;
   int width_;
   int height_;
+  BitmapEncoding encoding_;
 };
 
 class Font {
@@ -375,23 +636,34 @@ class Font {
 
   const std::vector<Glyph> &get_glyphs() const;
 
+  /// Get the y-offset from the top of the text to the baseline.
+  int get_baseline() const;
+
+  /// Get the height of a line of text.
+  int get_height() const;
+
  protected:
   std::vector<Glyph> glyphs_;
   int baseline_;
   int bottom_;
+  /// Index of the glyph for each ASCII character, -1 if the font doesn't have it.
+  int16_t ascii_index_[128];
 };
 
 class Image {
  public:
-  Image(const uint8_t *data_start, int width, int height);
+  Image(const uint8_t *data_start, int width, int height, BitmapEncoding encoding = BITMAP_ENCODING_RAW);
   bool get_pixel(int x, int y) const;
   int get_width() const;
   int get_height() const;
 
  protected:
+  friend DisplayBuffer;
+
   int width_;
   int height_;
   const uint8_t *data_start_;
+  BitmapEncoding encoding_;
 };
 
 template<typename... Ts> class DisplayPageShowAction : public Action<Ts...> {
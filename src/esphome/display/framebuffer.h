@@ -0,0 +1,166 @@
+#ifndef ESPHOME_DISPLAY_FRAMEBUFFER_H
+#define ESPHOME_DISPLAY_FRAMEBUFFER_H
+
+#include "esphome/defines.h"
+
+#ifdef USE_DISPLAY
+
+#include <cstring>
+#include "esphome/display/display.h"
+
+ESPHOME_NAMESPACE_BEGIN
+
+namespace display {
+
+/** Pixel access for a row-major framebuffer with BPP bits per pixel (1, 2 or 4 gray levels, see the
+ * specialization for 16).
+ *
+ * Several pixels are packed into a byte, the leftmost one in the most significant bits, and rows are padded to whole
+ * bytes. Everything is resolved at compile time for each depth, so the pixel path doesn't branch on the format.
+ *
+ * The buffer needs get_stride(width) * height bytes, for example for 128x160: 2560 bytes with 1 bpp, 5120 bytes
+ * with 2 bpp and 10240 bytes with 4 bpp.
+ */
+template<uint8_t BPP> struct PackedFramebuffer {
+  static_assert(BPP == 1 || BPP == 2 || BPP == 4, "Packed framebuffers support 1, 2, 4 and 16 bits per pixel");
+
+  static const uint8_t PIXELS_PER_BYTE = 8 / BPP;
+  static const uint8_t MAX_VALUE = (1 << BPP) - 1;
+
+  /// Get the number of bytes of a row.
+  static uint32_t get_stride(int width) { return (uint32_t(width) * BPP + 7u) / 8u; }
+
+  /// Convert a color (COLOR_OFF, COLOR_ON or color_rgb()) to a pixel value, from 0 (off/black) to MAX_VALUE.
+  static uint16_t encode(int color) {
+    if (color & COLOR_RGB_FLAG)
+      return get_color_luminance(color) >> (8 - BPP);
+    return color ? MAX_VALUE : 0;
+  }
+
+  /// Get the byte with all pixels set to value.
+  static uint8_t get_fill_byte(uint16_t value) { return value * (0xFF / MAX_VALUE); }
+
+  static uint16_t get_pixel(const uint8_t *buffer, uint32_t stride, int x, int y) {
+    const uint8_t shift = 8 - BPP - (x % PIXELS_PER_BYTE) * BPP;
+    return (buffer[y * stride + x / PIXELS_PER_BYTE] >> shift) & MAX_VALUE;
+  }
+
+  static void set_pixel(uint8_t *buffer, uint32_t stride, int x, int y, uint16_t value) {
+    uint8_t *pos = buffer + y * stride + x / PIXELS_PER_BYTE;
+    const uint8_t shift = 8 - BPP - (x % PIXELS_PER_BYTE) * BPP;
+    *pos = (*pos & ~(MAX_VALUE << shift)) | (value << shift);
+  }
+
+  /// Set width pixels to the right of x, y. The whole bytes of the run are written at once.
+  static void fill_row(uint8_t *buffer, uint32_t stride, int x, int y, int width, uint16_t value) {
+    const int end = x + width;
+    for (; x < end && x % PIXELS_PER_BYTE != 0; x++)
+      set_pixel(buffer, stride, x, y, value);
+    uint8_t *row = buffer + y * stride;
+    const uint8_t fill = get_fill_byte(value);
+    for (; x + PIXELS_PER_BYTE <= end; x += PIXELS_PER_BYTE)
+      row[x / PIXELS_PER_BYTE] = fill;
+    for (; x < end; x++)
+      set_pixel(buffer, stride, x, y, value);
+  }
+
+  static void fill(uint8_t *buffer, uint32_t length, uint16_t value) { memset(buffer, get_fill_byte(value), length); }
+};
+
+/** RGB565 pixels, stored big endian as SPI TFT controllers expect them. The buffer needs 2 bytes per pixel, for
+ * example 40960 bytes for 128x160.
+ */
+template<> struct PackedFramebuffer<16> {
+  static const uint16_t MAX_VALUE = 0xFFFF;
+
+  static uint32_t get_stride(int width) { return uint32_t(width) * 2u; }
+
+  /// Convert a color (COLOR_OFF, COLOR_ON or color_rgb()) to RGB565, COLOR_ON is white.
+  static uint16_t encode(int color) {
+    if (color & COLOR_RGB_FLAG)
+      return ((color >> 8) & 0xF800) | ((color >> 5) & 0x07E0) | ((color >> 3) & 0x001F);
+    return color ? MAX_VALUE : 0;
+  }
+
+  static uint16_t get_pixel(const uint8_t *buffer, uint32_t stride, int x, int y) {
+    const uint8_t *pos = buffer + y * stride + x * 2u;
+    return (uint16_t(pos[0]) << 8) | pos[1];
+  }
+
+  static void set_pixel(uint8_t *buffer, uint32_t stride, int x, int y, uint16_t value) {
+    uint8_t *pos = buffer + y * stride + x * 2u;
+    pos[0] = value >> 8;
+    pos[1] = value;
+  }
+
+  static void fill_row(uint8_t *buffer, uint32_t stride, int x, int y, int width, uint16_t value) {
+    uint8_t *pos = buffer + y * stride + x * 2u;
+    const uint8_t high = value >> 8;
+    const uint8_t low = value;
+    for (int i = 0; i < width; i++) {
+      *pos++ = high;
+      *pos++ = low;
+    }
+  }
+
+  static void fill(uint8_t *buffer, uint32_t length, uint16_t value) {
+    if ((value >> 8) == (value & 0xFF)) {
+      memset(buffer, value & 0xFF, length);
+      return;
+    }
+    fill_row(buffer, 0, 0, 0, length / 2u, value);
+  }
+};
+
+/** A DisplayBuffer that draws into a PackedFramebuffer, for drivers whose display RAM has the same row-major layout
+ * with BPP bits per pixel.
+ */
+template<uint8_t BPP> class PackedDisplayBuffer : public DisplayBuffer {
+ public:
+  static const uint8_t BITS_PER_PIXEL = BPP;
+
+  /// Get the size of the framebuffer in bytes.
+  uint32_t get_framebuffer_size() {
+    return PackedFramebuffer<BPP>::get_stride(this->get_width_internal()) * this->get_height_internal();
+  }
+
+ protected:
+  /// Allocate the framebuffer, call this in setup() instead of init_internal_().
+  void init_framebuffer_() {
+    this->stride_ = PackedFramebuffer<BPP>::get_stride(this->get_width_internal());
+    this->init_internal_(this->get_framebuffer_size());
+  }
+
+  /// Colors are converted to gray levels by PackedFramebuffer::encode().
+  bool supports_rgb_colors_() const override { return true; }
+
+  void fill_internal_(int color) override {
+    PackedFramebuffer<BPP>::fill(this->buffer_, this->get_framebuffer_size(), PackedFramebuffer<BPP>::encode(color));
+  }
+
+  void draw_absolute_pixel_internal(int x, int y, int color) override {
+    if (x < 0 || x >= this->get_width_internal() || y < 0 || y >= this->get_height_internal())
+      return;
+    PackedFramebuffer<BPP>::set_pixel(this->buffer_, this->stride_, x, y, PackedFramebuffer<BPP>::encode(color));
+  }
+
+  void draw_absolute_horizontal_line_internal(int x, int y, int width, int color) override {
+    PackedFramebuffer<BPP>::fill_row(this->buffer_, this->stride_, x, y, width, PackedFramebuffer<BPP>::encode(color));
+  }
+
+  void draw_absolute_vertical_line_internal(int x, int y, int height, int color) override {
+    const uint16_t value = PackedFramebuffer<BPP>::encode(color);
+    for (int i = 0; i < height; i++)
+      PackedFramebuffer<BPP>::set_pixel(this->buffer_, this->stride_, x, y + i, value);
+  }
+
+  uint32_t stride_{0};
+};
+
+}  // namespace display
+
+ESPHOME_NAMESPACE_END
+
+#endif  // USE_DISPLAY
+
+#endif  // ESPHOME_DISPLAY_FRAMEBUFFER_H
@@ -5,6 +5,8 @@
 #include "esphome/display/lcd_display.h"
 #include "esphome/log.h"
 
+#include <algorithm>
+
 ESPHOME_NAMESPACE_BEGIN
 
 namespace display {
@@ -34,8 +36,10 @@ static const uint8_t LCD_DISPLAY_FUNCTION_5X10_DOTS = 0x04;
 
 void LCDDisplay::setup() {
   this->buffer_ = new uint8_t[this->rows_ * this->columns_];
+  this->shadow_ = new uint8_t[this->rows_ * this->columns_];
+  // the clear display command below fills the DDRAM with spaces
   for (uint8_t i = 0; i < this->rows_ * this->columns_; i++)
-    this->buffer_[i] = ' ';
+    this->buffer_[i] = this->shadow_[i] = ' ';
 
   uint8_t display_function = 0;
 
@@ -85,28 +89,53 @@ void LCDDisplay::setup() {
 
 float LCDDisplay::get_setup_priority() const { return setup_priority::POST_HARDWARE; }
 void HOT LCDDisplay::display() {
-  this->command_(LCD_DISPLAY_COMMAND_SET_DDRAM_ADDR | 0);
-
-  for (uint8_t i = 0; i < this->columns_; i++)
-    this->send(this->buffer_[i], true);
-
-  if (this->rows_ >= 3) {
-    for (uint8_t i = 0; i < this->columns_; i++)
-      this->send(this->buffer_[this->columns_ * 2 + i], true);
-  }
-
-  if (this->rows_ >= 1) {
-    this->command_(LCD_DISPLAY_COMMAND_SET_DDRAM_ADDR | 0x40);
-
-    for (uint8_t i = 0; i < this->columns_; i++)
-      this->send(this->buffer_[this->columns_ + i], true);
-
-    if (this->rows_ >= 4) {
-      for (uint8_t i = 0; i < this->columns_; i++)
-        this->send(this->buffer_[this->columns_ * 3 + i], true);
+  this->transactions_ = 0;
+  // DDRAM address the LCD writes the next character to, -1 if unknown
+  int16_t cursor = -1;
+  for (uint8_t row = 0; row < this->rows_; row++) {
+    const uint8_t *line = this->buffer_ + row * this->columns_;
+    uint8_t *shadow = this->shadow_ + row * this->columns_;
+    uint8_t col = 0;
+    while (col < this->columns_) {
+      if (line[col] == shadow[col]) {
+        col++;
+        continue;
+      }
+      // Find the end of this run of changed cells. A single unchanged cell in between is cheaper to send again than
+      // setting the DDRAM address, so such gaps are included in the run.
+      uint8_t end = col + 1;
+      while (end < this->columns_) {
+        if (line[end] != shadow[end]) {
+          end++;
+        } else if (end + 1 < this->columns_ && line[end + 1] != shadow[end + 1]) {
+          end += 2;
+        } else {
+          break;
+        }
+      }
+
+      const uint8_t address = this->get_ddram_address_(row, col);
+      if (cursor != address)
+        this->command_(LCD_DISPLAY_COMMAND_SET_DDRAM_ADDR | address);
+      this->send_data_(line + col, end - col);
+      memcpy(shadow + col, line + col, end - col);
+      cursor = address + end - col;
+      col = end;
     }
   }
+  if (this->transactions_ != 0)
+    ESP_LOGV(TAG, "Display updated with %u transactions.", this->transactions_);
+  this->last_transactions_ = this->transactions_;
+}
+uint8_t LCDDisplay::get_ddram_address_(uint8_t row, uint8_t column) const {
+  // rows 2 and 3 continue rows 0 and 1 in the DDRAM
+  return (row & 1 ? 0x40 : 0) + (row >= 2 ? this->columns_ : 0) + column;
 }
+void LCDDisplay::send_data_(const uint8_t *data, uint8_t len) {
+  for (uint8_t i = 0; i < len; i++)
+    this->send(data[i], true);
+}
+uint32_t LCDDisplay::get_transactions_per_update() const { return this->last_transactions_; }
 void LCDDisplay::update() {
   for (uint8_t i = 0; i < this->rows_ * this->columns_; i++)
     this->buffer_[i] = ' ';
@@ -226,6 +255,7 @@ void GPIOLCDDisplay::write_n_bits(uint8_t value, uint8_t n) {
   delayMicroseconds(1);  // >450ns
   this->enable_pin_->digital_write(false);
   delayMicroseconds(40);  // >37us
+  this->transactions_++;
 }
 void GPIOLCDDisplay::send(uint8_t value, bool rs) {
   this->rs_pin_->digital_write(rs);
@@ -241,6 +271,14 @@ GPIOLCDDisplay::GPIOLCDDisplay(uint8_t columns, uint8_t rows, uint32_t update_in
     : LCDDisplay(columns, rows, update_interval) {}
 
 #ifdef USE_LCD_DISPLAY_PCF8574
+/// Port writes for one character without padding.
+static const uint32_t PCF8574_LCD_BYTES_PER_CHAR = 6;
+/// Size of a transaction, the Wire library buffers at most 32 bytes.
+static const uint8_t PCF8574_LCD_BUFFER_SIZE = 30;
+static const uint32_t PCF8574_LCD_MAX_BYTES_PER_CHAR = PCF8574_LCD_BUFFER_SIZE;
+/// Time in µs the LCD needs to execute a data write (37µs nominal, more with a slow oscillator).
+static const uint32_t PCF8574_LCD_EXECUTION_TIME = 80;
+
 void PCF8574LCDDisplay::setup() {
   ESP_LOGCONFIG(TAG, "Setting up PCF8574 LCD Display...");
   if (!this->write_bytes(0x08, nullptr, 0)) {
@@ -248,12 +286,19 @@ void PCF8574LCDDisplay::setup() {
     return;
   }
 
+  // Between the last enable pulse of a character and the first one of the next there are 2 port writes of 9
+  // clock cycles each. Add idle writes until that takes at least as long as the LCD needs to execute the write.
+  const uint32_t frequency = this->parent_->get_frequency();
+  const uint32_t bytes = (PCF8574_LCD_EXECUTION_TIME * frequency + 9 * 1000000 - 1) / (9 * 1000000);
+  this->pad_ = bytes <= 2 ? 0 : std::min(bytes - 2, PCF8574_LCD_MAX_BYTES_PER_CHAR - PCF8574_LCD_BYTES_PER_CHAR);
+
   LCDDisplay::setup();
 }
 void PCF8574LCDDisplay::dump_config() {
   ESP_LOGCONFIG(TAG, "PCF8574 LCD Display:");
   ESP_LOGCONFIG(TAG, "  Columns: %u, Rows: %u", this->columns_, this->rows_);
   LOG_I2C_DEVICE(this);
+  ESP_LOGCONFIG(TAG, "  Padding: %u writes per character", this->pad_);
   LOG_UPDATE_INTERVAL(this);
   if (this->is_failed()) {
     ESP_LOGE(TAG, "Communication with LCD Display failed!");
@@ -272,10 +317,42 @@ void PCF8574LCDDisplay::write_n_bits(uint8_t value, uint8_t n) {
   delayMicroseconds(1);  // >450ns
   this->write_bytes(data, nullptr, 0);
   delayMicroseconds(100);  // >37us
+  this->transactions_ += 3;
+}
+/** Append the port writes that clock one byte into the LCD to dest: pad idle writes, then both nibbles with an
+ * enable pulse each. Returns the new end of dest.
+ */
+static uint8_t *pcf8574_lcd_encode(uint8_t *dest, uint8_t value, bool rs, uint8_t pad) {
+  const uint8_t nibbles[2] = {uint8_t((value & 0xF0) | rs | 0x08), uint8_t(((value << 4) & 0xF0) | rs | 0x08)};
+  for (uint8_t i = 0; i < pad; i++)
+    *dest++ = nibbles[0];
+  for (uint8_t nibble : nibbles) {
+    *dest++ = nibble;
+    *dest++ = nibble | 0x04;  // ENABLE
+    *dest++ = nibble;
+  }
+  return dest;
 }
 void PCF8574LCDDisplay::send(uint8_t value, bool rs) {
-  this->write_n_bits((value & 0xF0) | rs, 0);
-  this->write_n_bits(((value << 4) & 0xF0) | rs, 0);
+  uint8_t data[PCF8574_LCD_MAX_BYTES_PER_CHAR];
+  uint8_t *end = pcf8574_lcd_encode(data, value, rs, this->pad_);
+  this->write_bytes(data[0], data + 1, end - data - 1);
+  this->transactions_++;
+}
+void HOT PCF8574LCDDisplay::send_data_(const uint8_t *data, uint8_t len) {
+  // Send as many characters per I2C transaction as fit in the 32 byte buffer of the Wire library, the padding
+  // calculated in setup() gives the LCD time to process each character before the next one arrives.
+  uint8_t buffer[PCF8574_LCD_BUFFER_SIZE];
+  uint8_t *end = buffer;
+  const uint8_t char_size = PCF8574_LCD_BYTES_PER_CHAR + this->pad_;
+  for (uint8_t i = 0; i < len; i++) {
+    end = pcf8574_lcd_encode(end, data[i], true, this->pad_);
+    if (end + char_size > buffer + sizeof(buffer) || i + 1 == len) {
+      this->write_bytes(buffer[0], buffer + 1, end - buffer - 1);
+      this->transactions_++;
+      end = buffer;
+    }
+  }
 }
 PCF8574LCDDisplay::PCF8574LCDDisplay(I2CComponent *parent, uint8_t columns, uint8_t rows, uint8_t address,
                                      uint32_t update_interval)
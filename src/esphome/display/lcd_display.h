@@ -27,8 +27,12 @@ class LCDDisplay : public PollingComponent {
   void setup() override;
   float get_setup_priority() const override;
   void update() override;
+  /// Send the cells that changed since the last call to the LCD.
   void display();
 
+  /// Get the number of bus transactions the last display() call needed.
+  uint32_t get_transactions_per_update() const;
+
   /// Print the given text at the specified column and row.
   void print(uint8_t column, uint8_t row, const char *str);
   /// Print the given string at the specified column and row.
@@ -55,11 +59,20 @@ class LCDDisplay : public PollingComponent {
   virtual void write_n_bits(uint8_t value, uint8_t n) = 0;
   virtual void send(uint8_t value, bool rs) = 0;
 
+  /// Write len characters starting at the current DDRAM address, by default one send() call per character.
+  virtual void send_data_(const uint8_t *data, uint8_t len);
+
   void command_(uint8_t value);
+  uint8_t get_ddram_address_(uint8_t row, uint8_t column) const;
 
   uint8_t columns_;
   uint8_t rows_;
   uint8_t *buffer_{nullptr};
+  /// What the LCD currently shows.
+  uint8_t *shadow_{nullptr};
+  /// Bus transactions in the current display() call, incremented by the implementations.
+  uint32_t transactions_{0};
+  uint32_t last_transactions_{0};
   lcd_writer_t writer_;
 };
 
@@ -99,6 +112,10 @@ class PCF8574LCDDisplay : public LCDDisplay, public I2CDevice {
   bool is_four_bit_mode() override;
   void write_n_bits(uint8_t value, uint8_t n) override;
   void send(uint8_t value, bool rs) override;
+  void send_data_(const uint8_t *data, uint8_t len) override;
+
+  /// Idle port writes before each character, so that the LCD keeps up at higher bus frequencies.
+  uint8_t pad_{0};
 };
 #endif
 
@@ -122,6 +122,7 @@ void MAX7219Component::setup() {
   ESP_LOGCONFIG(TAG, "Setting up MAX7219...");
   this->spi_setup();
   this->buffer_ = new uint8_t[this->num_chips_ * 8];
+  this->shadow_ = new uint8_t[this->num_chips_ * 8];
   for (uint8_t i = 0; i < this->num_chips_ * 8; i++)
     this->buffer_[i] = 0;
 
@@ -142,15 +143,36 @@ void MAX7219Component::dump_config() {
   LOG_UPDATE_INTERVAL(this);
 }
 
-void MAX7219Component::display() {
+void HOT MAX7219Component::display() {
+  uint32_t transactions = 0;
   for (uint8_t i = 0; i < 8; i++) {
+    // All chips shift the data through in one transaction per digit, so a digit can only be skipped if it's
+    // unchanged on all of them. Chips where it didn't change get a no-op instead.
+    bool changed = false;
+    for (uint8_t j = 0; j < this->num_chips_; j++)
+      changed |= !this->shadow_valid_ || this->buffer_[j * 8 + i] != this->shadow_[j * 8 + i];
+    if (!changed)
+      continue;
+
     this->enable();
     for (uint8_t j = 0; j < this->num_chips_; j++) {
-      this->send_byte_(8 - i, this->buffer_[j * 8 + i]);
+      const uint8_t index = j * 8 + i;
+      if (this->shadow_valid_ && this->buffer_[index] == this->shadow_[index]) {
+        this->send_byte_(MAX7219_REGISTER_NOOP, 0);
+      } else {
+        this->send_byte_(8 - i, this->buffer_[index]);
+        this->shadow_[index] = this->buffer_[index];
+      }
     }
     this->disable();
+    transactions++;
   }
+  this->shadow_valid_ = true;
+  if (transactions != 0)
+    ESP_LOGV(TAG, "Display updated with %u transactions.", transactions);
+  this->last_transactions_ = transactions;
 }
+uint32_t MAX7219Component::get_transactions_per_update() const { return this->last_transactions_; }
 void MAX7219Component::send_byte_(uint8_t a_register, uint8_t data) {
   this->write_byte(a_register);
   this->write_byte(data);
@@ -33,8 +33,12 @@ class MAX7219Component : public PollingComponent, public SPIDevice {
 
   float get_setup_priority() const override;
 
+  /// Send the digits that changed since the last call to the chips.
   void display();
 
+  /// Get the number of SPI transactions the last display() call needed.
+  uint32_t get_transactions_per_update() const;
+
   void set_intensity(uint8_t intensity);
   void set_num_chips(uint8_t num_chips);
 
@@ -64,6 +68,10 @@ class MAX7219Component : public PollingComponent, public SPIDevice {
   uint8_t intensity_{15};  /// Intensity of the display from 0 to 15 (most)
   uint8_t num_chips_{1};
   uint8_t *buffer_;
+  /// The digits the chips currently show, only valid after the first display() call.
+  uint8_t *shadow_{nullptr};
+  bool shadow_valid_{false};
+  uint32_t last_transactions_{0};
   optional<max7219_writer_t> writer_{};
 };
 
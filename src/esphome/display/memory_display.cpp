@@ -0,0 +1,82 @@
+#include "esphome/defines.h"
+
+#ifdef USE_MEMORY_DISPLAY
+
+#include "esphome/display/memory_display.h"
+#include "esphome/log.h"
+
+ESPHOME_NAMESPACE_BEGIN
+
+namespace display {
+
+static const char *TAG = "display.memory";
+
+MemoryDisplay::MemoryDisplay(int width, int height, uint32_t update_interval)
+    : PollingComponent(update_interval), width_(width), height_(height) {}
+void MemoryDisplay::set_log_frames(bool log_frames) { this->log_frames_ = log_frames; }
+uint32_t MemoryDisplay::render() {
+  this->do_update_();
+  return this->get_render_time();
+}
+void MemoryDisplay::render_all_pages() {
+  DisplayPage *start = this->page_;
+  if (start == nullptr) {
+    ESP_LOGD(TAG, "Rendering took %u us", this->render());
+    return;
+  }
+  uint32_t index = 0;
+  do {
+    ESP_LOGD(TAG, "Rendering page %u took %u us", index++, this->render());
+    this->show_next_page();
+  } while (this->page_ != start);
+}
+bool MemoryDisplay::get_pixel(int x, int y) const {
+  if (x < 0 || x >= this->width_ || y < 0 || y >= this->height_)
+    return false;
+  return PackedFramebuffer<1>::get_pixel(this->buffer_, this->stride_, x, y);
+}
+std::string MemoryDisplay::to_pbm() const {
+  // the buffer already has the layout of the PBM raster: rows padded to whole bytes, MSB first, 1 is black
+  char header[32];
+  snprintf(header, sizeof(header), "P4\n%d %d\n", this->width_, this->height_);
+  std::string pbm(header);
+  pbm.append(reinterpret_cast<const char *>(this->buffer_), this->stride_ * this->height_);
+  return pbm;
+}
+void MemoryDisplay::setup() {
+  ESP_LOGCONFIG(TAG, "Setting up memory display...");
+  this->init_framebuffer_();
+}
+void MemoryDisplay::update() {
+  if (!this->should_render_())
+    return;
+  this->do_update_();
+  ESP_LOGV(TAG, "Rendering took %u us", this->get_render_time());
+  if (this->log_frames_)
+    this->log_frame_();
+}
+void MemoryDisplay::dump_config() {
+  LOG_DISPLAY("", "Memory Display", this);
+  ESP_LOGCONFIG(TAG, "  Framebuffer: %u bpp, %u bytes", BITS_PER_PIXEL, this->get_framebuffer_size());
+  ESP_LOGCONFIG(TAG, "  Log Frames: %s", YESNO(this->log_frames_));
+  LOG_UPDATE_INTERVAL(this);
+}
+float MemoryDisplay::get_setup_priority() const { return setup_priority::POST_HARDWARE; }
+int MemoryDisplay::get_height_internal() { return this->height_; }
+int MemoryDisplay::get_width_internal() { return this->width_; }
+void MemoryDisplay::log_frame_() {
+  std::string line;
+  line.reserve(this->width_);
+  for (int y = 0; y < this->height_; y++) {
+    line.clear();
+    for (int x = 0; x < this->width_; x++)
+      line += this->get_pixel(x, y) ? '#' : '.';
+    ESP_LOGV(TAG, "%s", line.c_str());
+  }
+}
+
+}  // namespace display
+
+ESPHOME_NAMESPACE_END
+
+#endif  // USE_MEMORY_DISPLAY
@@ -0,0 +1,63 @@
+#ifndef ESPHOME_DISPLAY_MEMORY_DISPLAY_H
+#define ESPHOME_DISPLAY_MEMORY_DISPLAY_H
+
+#include "esphome/defines.h"
+
+#ifdef USE_MEMORY_DISPLAY
+
+#include "esphome/component.h"
+#include "esphome/display/framebuffer.h"
+
+ESPHOME_NAMESPACE_BEGIN
+
+namespace display {
+
+/** A display that only renders into memory, with 1 bit per pixel and any resolution.
+ *
+ * It runs the same writer lambdas and pages as a real display, so layouts can be checked and their render cost
+ * measured without the display hardware: every update logs the render time, the frame can be logged as ASCII art
+ * and exported as a binary PBM image, for example to compare against a reference image.
+ */
+class MemoryDisplay : public PollingComponent, public PackedDisplayBuffer<1> {
+ public:
+  MemoryDisplay(int width, int height, uint32_t update_interval = 5000);
+
+  /// Log each rendered frame as ASCII art (verbose, only useful for small resolutions).
+  void set_log_frames(bool log_frames);
+
+  /// Render the current page (or writer) and return the time it took in µs.
+  uint32_t render();
+
+  /// Render each page once and log how long each one took, the current page stays the same.
+  void render_all_pages();
+
+  /// Get a pixel of the rendered frame at the absolute (not rotated) position.
+  bool get_pixel(int x, int y) const;
+
+  /// Get the rendered frame as binary PBM (P4) image, pixels that are ON are black.
+  std::string to_pbm() const;
+
+  // ========== INTERNAL METHODS ==========
+  // (In most use cases you won't need these)
+  void setup() override;
+  void update() override;
+  void dump_config() override;
+  float get_setup_priority() const override;
+
+ protected:
+  int get_height_internal() override;
+  int get_width_internal() override;
+  void log_frame_();
+
+  int width_;
+  int height_;
+  bool log_frames_{false};
+};
+
+}  // namespace display
+
+ESPHOME_NAMESPACE_END
+
+#endif  // USE_MEMORY_DISPLAY
+
+#endif  // ESPHOME_DISPLAY_MEMORY_DISPLAY_H
@@ -5,15 +5,34 @@
 #include "esphome/display/nextion.h"
 #include "esphome/log.h"
 
+#include <algorithm>
+
 ESPHOME_NAMESPACE_BEGIN
 
 namespace display {
 
 static const char *TAG = "display.nextion";
 
+/// Maximum number of commands sent without having received their reply, the Nextion has a 1kB serial buffer.
+static const uint8_t NEXTION_MAX_IN_FLIGHT = 8;
+/// Time the Nextion has to reply to a command once it received it and replied to the previous ones.
+static const uint32_t NEXTION_ACK_TIMEOUT = 100;
+/// Time the Nextion has to reply to a page change, it draws the whole page first.
+static const uint32_t NEXTION_PAGE_ACK_TIMEOUT = 500;
+/// Time after which the sync command is sent again, the queued commands are dropped then.
+static const uint32_t NEXTION_SYNC_TIMEOUT = 500;
+/// First value returned by the sync command, unlikely to be sent by the HMI.
+static const uint32_t NEXTION_SYNC_ID_BASE = 0x4E580000;
+
+static bool is_page_command(const std::string &command) { return command.compare(0, 5, "page ") == 0; }
+static uint32_t get_ack_timeout(const std::string &command) {
+  return is_page_command(command) ? NEXTION_PAGE_ACK_TIMEOUT : NEXTION_ACK_TIMEOUT;
+}
+
 void Nextion::setup() {
   this->send_command_no_ack("");
-  this->send_command_printf("bkcmd=3");
+  // whether the Nextion replies to bkcmd=3 depends on the previous setting
+  this->send_command_no_ack("bkcmd=3");
   this->goto_page("0");
 }
 float Nextion::get_setup_priority() const { return setup_priority::POST_HARDWARE; }
@@ -21,56 +40,38 @@ void Nextion::update() {
   if (this->writer_.has_value()) {
     (*this->writer_)(*this);
   }
+  // send everything the writer changed in one go
+  this->send_queued_();
 }
-void Nextion::send_command_no_ack(const char *command) {
-  // Flush RX...
-  this->loop();
+void Nextion::send_command_no_ack(const char *command) { this->queue_command_("", command, false); }
 
-  this->write_str(command);
-  const uint8_t data[3] = {0xFF, 0xFF, 0xFF};
-  this->write_array(data, sizeof(data));
-}
-
-bool Nextion::ack_() {
-  if (!this->wait_for_ack_)
-    return true;
-
-  uint32_t start = millis();
-  while (!this->read_until_ack_()) {
-    if (millis() - start > 100) {
-      ESP_LOGW(TAG, "Waiting for ACK timed out!");
-      return false;
-    }
-  }
-  return true;
-}
 void Nextion::set_component_text(const char *component, const char *text) {
-  this->send_command_printf("%s.txt=\"%s\"", component, text);
+  this->send_assignment_printf_(component, "txt", "\"%s\"", text);
 }
 void Nextion::set_component_value(const char *component, int value) {
-  this->send_command_printf("%s.val=%d", component, value);
+  this->send_assignment_printf_(component, "val", "%d", value);
 }
 void Nextion::display_picture(int picture_id, int x_start, int y_start) {
   this->send_command_printf("pic %d %d %d", picture_id, x_start, y_start);
 }
 void Nextion::set_component_background_color(const char *component, const char *color) {
-  this->send_command_printf("%s.bco=\"%s\"", component, color);
+  this->send_assignment_printf_(component, "bco", "\"%s\"", color);
 }
 void Nextion::set_component_pressed_background_color(const char *component, const char *color) {
-  this->send_command_printf("%s.bco2=\"%s\"", component, color);
+  this->send_assignment_printf_(component, "bco2", "\"%s\"", color);
 }
 void Nextion::set_component_font_color(const char *component, const char *color) {
-  this->send_command_printf("%s.pco=\"%s\"", component, color);
+  this->send_assignment_printf_(component, "pco", "\"%s\"", color);
 }
 void Nextion::set_component_pressed_font_color(const char *component, const char *color) {
-  this->send_command_printf("%s.pco2=\"%s\"", component, color);
+  this->send_assignment_printf_(component, "pco2", "\"%s\"", color);
 }
 void Nextion::set_component_coordinates(const char *component, int x, int y) {
-  this->send_command_printf("%s.xcen=%d", component, x);
-  this->send_command_printf("%s.ycen=%d", component, y);
+  this->send_assignment_printf_(component, "xcen", "%d", x);
+  this->send_assignment_printf_(component, "ycen", "%d", y);
 }
 void Nextion::set_component_font(const char *component, uint8_t font_id) {
-  this->send_command_printf("%s.font=%d", component, font_id);
+  this->send_assignment_printf_(component, "font", "%d", font_id);
 }
 void Nextion::goto_page(const char *page) { this->send_command_printf("page %s", page); }
 bool Nextion::send_command_printf(const char *format, ...) {
@@ -83,14 +84,159 @@ bool Nextion::send_command_printf(const char *format, ...) {
     ESP_LOGW(TAG, "Building command for format '%s' failed!", format);
     return false;
   }
-  this->send_command_no_ack(buffer);
-  if (!this->ack_()) {
-    ESP_LOGW(TAG, "Sending command '%s' failed because no ACK was received", buffer);
+  this->queue_command_("", buffer);
+  return true;
+}
+bool Nextion::send_assignment_printf_(const char *component, const char *attribute, const char *format, ...) {
+  char buffer[256];
+  int len = snprintf(buffer, sizeof(buffer), "%s.%s=", component, attribute);
+  va_list arg;
+  va_start(arg, format);
+  int ret = vsnprintf(buffer + len, sizeof(buffer) - len, format, arg);
+  va_end(arg);
+  if (ret <= 0) {
+    ESP_LOGW(TAG, "Building command for format '%s' failed!", format);
     return false;
   }
-
+  this->queue_command_(std::string(buffer, len - 1), buffer);
   return true;
 }
+void Nextion::queue_command_(const std::string &key, const std::string &command, bool expect_reply) {
+  if (!key.empty()) {
+    // Last write wins: replace a queued assignment to the same attribute. Don't look past other commands, those
+    // can depend on the order (a page change for example).
+    for (auto it = this->queue_.rbegin(); it != this->queue_.rend() && !it->key.empty(); it++) {
+      if (it->key == key) {
+        it->command = command;
+        this->commands_skipped_++;
+        return;
+      }
+    }
+  }
+  this->queue_.push_back(NextionCommand{key, command, 0, expect_reply});
+}
+void HOT Nextion::send_queued_() {
+  if (this->syncing_)
+    return;
+
+  uint32_t sent = 0;
+  bool sync = false;
+  while (!this->queue_.empty() && this->in_flight_.size() < NEXTION_MAX_IN_FLIGHT) {
+    if (this->wait_for_ack_) {
+      const bool expect_reply = this->queue_.front().expect_reply;
+      // A possible reply to a command without tracked reply can't be told apart from the others, so wait for the
+      // replies to the previous commands before sending it and sync before sending the next tracked command.
+      if (!expect_reply && !this->in_flight_.empty())
+        break;
+      if (expect_reply && sync)
+        break;
+    }
+    NextionCommand command = std::move(this->queue_.front());
+    this->queue_.pop_front();
+
+    if (!command.key.empty()) {
+      std::string *state = this->get_display_state_(command.key);
+      if (state != nullptr && *state == command.command) {
+        // the display already shows this value
+        this->commands_skipped_++;
+        continue;
+      }
+      if (state != nullptr)
+        *state = command.command;
+      else
+        this->display_state_.emplace_back(command.key, command.command);
+    } else if (is_page_command(command.command)) {
+      // the Nextion resets the components when the page changes
+      this->display_state_.clear();
+    }
+
+    const uint32_t received_at = this->write_command_(command.command);
+    this->commands_sent_++;
+    sent++;
+    if (!command.expect_reply) {
+      sync = true;
+    } else if (this->wait_for_ack_) {
+      // the Nextion replies to the commands in order, so the timeout starts again when all replies before arrived
+      command.timeout_at = received_at + get_ack_timeout(command.command);
+      this->in_flight_.push_back(std::move(command));
+    }
+  }
+  if (sent != 0)
+    ESP_LOGV(TAG, "Sent %u commands, %u queued.", sent, uint32_t(this->queue_.size()));
+  if (sync && this->wait_for_ack_)
+    this->start_sync_();
+}
+void Nextion::process_reply_(bool success) {
+  if (this->syncing_)
+    // could be a late reply to a command that timed out or a reply to a command without tracked reply
+    return;
+  if (this->in_flight_.empty())
+    return;
+
+  if (!success) {
+    ESP_LOGW(TAG, "Sending command '%s' failed!", this->in_flight_.front().command.c_str());
+    this->forget_display_state_(this->in_flight_.front().key);
+  }
+  this->in_flight_.pop_front();
+  if (this->in_flight_.empty())
+    return;
+  // the Nextion only starts executing the next command now
+  NextionCommand &next = this->in_flight_.front();
+  const uint32_t timeout_at = millis() + get_ack_timeout(next.command);
+  if (int32_t(timeout_at - next.timeout_at) > 0)
+    next.timeout_at = timeout_at;
+}
+void Nextion::clear_in_flight_() {
+  for (auto &command : this->in_flight_) {
+    ESP_LOGW(TAG, "Sending command '%s' failed because no ACK was received", command.command.c_str());
+    this->forget_display_state_(command.key);
+  }
+  this->in_flight_.clear();
+}
+void Nextion::start_sync_() {
+  this->sync_id_++;
+  this->syncing_ = true;
+  char buffer[16];
+  snprintf(buffer, sizeof(buffer), "get %u", NEXTION_SYNC_ID_BASE + (this->sync_id_ & 0xFFFF));
+  this->sync_timeout_at_ = this->write_command_(buffer) + NEXTION_SYNC_TIMEOUT;
+  ESP_LOGV(TAG, "Waiting for the replies to sync (%s).", buffer);
+}
+uint32_t Nextion::write_command_(const std::string &command) {
+  this->write_array(reinterpret_cast<const uint8_t *>(command.data()), command.size());
+  const uint8_t end[3] = {0xFF, 0xFF, 0xFF};
+  this->write_array(end, sizeof(end));
+
+  // the UART sends in the background, after everything written before (10 bits per byte)
+  const uint32_t now = millis();
+  if (int32_t(this->tx_done_at_ - now) < 0)
+    this->tx_done_at_ = now;
+  const uint32_t baud_rate = std::max(this->parent_->get_baud_rate(), uint32_t(1));
+  this->tx_done_at_ += (command.size() + sizeof(end)) * 10000UL / baud_rate + 1;
+  return this->tx_done_at_;
+}
+void Nextion::handle_restart_() {
+  ESP_LOGD(TAG, "Nextion restarted.");
+  // everything that was sent before is gone, including bkcmd=3
+  this->commands_failed_ += this->in_flight_.size();
+  this->in_flight_.clear();
+  this->display_state_.clear();
+  this->syncing_ = false;
+  this->queue_.push_front(NextionCommand{"", "bkcmd=3", 0, false});
+}
+void Nextion::forget_display_state_(const std::string &key) {
+  this->commands_failed_++;
+  // the value of the attribute is unknown now, so the next assignment is sent in any case
+  std::string *state = key.empty() ? nullptr : this->get_display_state_(key);
+  if (state != nullptr)
+    state->clear();
+}
+std::string *Nextion::get_display_state_(const std::string &key) {
+  for (auto &state : this->display_state_) {
+    if (state.first == key)
+      return &state.second;
+  }
+  return nullptr;
+}
 void Nextion::hide_component(const char *component) { this->send_command_printf("vis %s,0", component); }
 void Nextion::show_component(const char *component) { this->send_command_printf("vis %s,1", component); }
 void Nextion::enable_component_touch(const char *component) { this->send_command_printf("tsw %s,1", component); }
@@ -113,7 +259,7 @@ void Nextion::circle(int center_x, int center_y, int radius, const char *color)
 void Nextion::filled_circle(int center_x, int center_y, int radius, const char *color) {
   this->send_command_printf("cirs %d,%d,%d,%s", center_x, center_y, radius, color);
 }
-bool Nextion::read_until_ack_() {
+void Nextion::read_replies_() {
   while (this->available() >= 4) {
     // flush preceding filler bytes
     uint8_t temp;
@@ -155,7 +301,7 @@ bool Nextion::read_until_ack_() {
     bool invalid_data_length = false;
     switch (event) {
       case 0x01:  // successful execution of instruction (ACK)
-        return true;
+        break;
       case 0x00:  // invalid instruction
         ESP_LOGW(TAG, "Nextion reported invalid instruction!");
         break;
@@ -211,6 +357,8 @@ bool Nextion::read_until_ack_() {
         uint8_t touch_event = data[2];  // 0 -> release, 1 -> press
         ESP_LOGD(TAG, "Got touch page=%u component=%u type=%s", page_id, component_id,
                  touch_event ? "PRESS" : "RELEASE");
+        // the HMI can change components or the page on touch
+        this->display_state_.clear();
         for (auto *touch : this->touch_) {
           touch->process(page_id, component_id, touch_event);
         }
@@ -229,11 +377,28 @@ bool Nextion::read_until_ack_() {
         break;
       }
       case 0x66:  // sendme page id
+        // the page changed, which resets the components
+        this->display_state_.clear();
+        break;
+      case 0x71: {  // numeric variable data return
+        if (data_length != 4) {
+          invalid_data_length = true;
+          break;
+        }
+        const uint32_t value = data[0] | (uint32_t(data[1]) << 8) | (uint32_t(data[2]) << 16) |
+                               (uint32_t(data[3]) << 24);
+        if (this->syncing_ && value == NEXTION_SYNC_ID_BASE + (this->sync_id_ & 0xFFFF)) {
+          ESP_LOGV(TAG, "Synced replies.");
+          this->syncing_ = false;
+        }
+        break;
+      }
+      case 0x88:  // system successful start up
+        this->handle_restart_();
+        break;
       case 0x70:  // string variable data return
-      case 0x71:  // numeric variable data return
       case 0x86:  // device automatically enters into sleep mode
       case 0x87:  // device automatically wakes up
-      case 0x88:  // system successful start up
       case 0x89:  // start SD card upgrade
       case 0xFD:  // data transparent transmit finished
       case 0xFE:  // data transparent transmit ready
@@ -245,14 +410,32 @@ bool Nextion::read_until_ack_() {
     if (invalid_data_length) {
       ESP_LOGW(TAG, "Invalid data length from nextion!");
     }
+    // all events up to 0x23 are replies to an instruction
+    if (event <= 0x23)
+      this->process_reply_(event == 0x01);
   }
-
-  return false;
 }
 void Nextion::loop() {
-  while (this->available() >= 4) {
-    this->read_until_ack_();
+  this->read_replies_();
+  const uint32_t now = millis();
+  if (this->syncing_) {
+    if (int32_t(now - this->sync_timeout_at_) > 0) {
+      // the Nextion doesn't respond, don't let the queue grow while waiting for it
+      if (!this->queue_.empty())
+        ESP_LOGW(TAG, "Nextion doesn't respond, dropping %u queued commands!", uint32_t(this->queue_.size()));
+      this->commands_failed_ += this->queue_.size();
+      this->queue_.clear();
+      this->display_state_.clear();
+      this->start_sync_();
+    }
+  } else if (!this->in_flight_.empty() && int32_t(now - this->in_flight_.front().timeout_at) > 0) {
+    this->clear_in_flight_();
+    // a missing reply shifts the matching of the following ones, so commands that seemed to succeed may have failed
+    this->display_state_.clear();
+    // late replies to these commands would be matched to the following ones
+    this->start_sync_();
   }
+  this->send_queued_();
 }
 #ifdef USE_TIME
 void Nextion::set_nextion_rtc_time(time::ESPTime time) {
@@ -286,6 +469,9 @@ void Nextion::set_component_text_printf(const char *component, const char *forma
     this->set_component_text(component, buffer);
 }
 void Nextion::set_wait_for_ack(bool wait_for_ack) { this->wait_for_ack_ = wait_for_ack; }
+uint32_t Nextion::get_commands_sent() const { return this->commands_sent_; }
+uint32_t Nextion::get_commands_skipped() const { return this->commands_skipped_; }
+uint32_t Nextion::get_commands_failed() const { return this->commands_failed_; }
 
 void NextionTouchComponent::process(uint8_t page_id, uint8_t component_id, bool on) {
   if (this->page_id_ == page_id && this->component_id_ == component_id) {
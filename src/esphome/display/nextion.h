@@ -5,6 +5,8 @@
 
 #ifdef USE_NEXTION
 
+#include <deque>
+#include <vector>
 #include "esphome/component.h"
 #include "esphome/uart_component.h"
 #include "esphome/time/rtc_component.h"
@@ -19,6 +21,33 @@ class Nextion;
 
 using nextion_writer_t = std::function<void(Nextion &)>;
 
+/// A command waiting in the queue of the Nextion component, or waiting for its reply.
+struct NextionCommand {
+  /// The attribute this command assigns (like "t0.txt"), empty for commands that can't be deduplicated.
+  std::string key;
+  std::string command;
+  /// Time the reply is due, pushed back when the command becomes the oldest one awaiting a reply.
+  uint32_t timeout_at;
+  /// Whether the reply to this command is tracked, false for commands sent with send_command_no_ack().
+  bool expect_reply;
+};
+
+/** Component for Nextion serial displays.
+ *
+ * Commands aren't written to the UART right away, they're queued and sent in one burst in the next loop() (or
+ * directly after the writer ran). The replies are matched to the sent commands in order without blocking, so
+ * the Nextion must be set to reply to every command (bkcmd=3, done in setup()).
+ *
+ * Commands that assign a component attribute (set_component_text() and friends) are deduplicated: a queued
+ * assignment is replaced by a newer one to the same attribute and assignments of the value the display already
+ * has are dropped. The known values are forgotten when the page changes (the Nextion resets the components then),
+ * when the Nextion restarts and on every touch event, since the HMI can change components or the page by itself.
+ *
+ * When replies can't be matched to commands anymore (after a timeout or after a command without tracked reply),
+ * the component sends "get <number>" and discards all replies until that number comes back. The reply timeout of
+ * a command starts when the Nextion has received it (estimated from the baud rate) and starts again when the
+ * reply to the previous command arrives, page changes get a longer timeout.
+ */
 class Nextion : public PollingComponent, public UARTDevice {
  public:
   /**
@@ -196,27 +225,67 @@ class Nextion : public PollingComponent, public UARTDevice {
   void set_writer(const nextion_writer_t &writer);
 
   /**
-   * Manually send a raw command to the display and don't wait for an acknowledgement packet.
+   * Manually queue a raw command for the display without tracking its reply.
    * @param command The command to write, for example "vis b0,0".
    */
   void send_command_no_ack(const char *command);
   /**
-   * Manually send a raw formatted command to the display.
+   * Manually queue a raw formatted command for the display.
    * @param format The printf-style command format, like "vis %s,0"
    * @param ... The format arguments
-   * @return Whether the send was successful.
+   * @return Whether the command could be built.
    */
   bool send_command_printf(const char *format, ...) __attribute__((format(printf, 2, 3)));
 
+  /// Whether to track the replies to sent commands, if false a command counts as acknowledged when it's sent.
   void set_wait_for_ack(bool wait_for_ack);
 
+  /// Get the number of commands written to the UART.
+  uint32_t get_commands_sent() const;
+  /// Get the number of assignments that were dropped because they were replaced or didn't change anything.
+  uint32_t get_commands_skipped() const;
+  /// Get the number of commands that failed, either reported by the Nextion or because the reply timed out.
+  uint32_t get_commands_failed() const;
+
  protected:
-  bool ack_();
-  bool read_until_ack_();
+  /// Queue an assignment of a printf-formatted value to an attribute of a component, like t0.txt="Hello".
+  bool send_assignment_printf_(const char *component, const char *attribute, const char *format, ...)
+      __attribute__((format(printf, 4, 5)));
+  void queue_command_(const std::string &key, const std::string &command, bool expect_reply = true);
+  /// Write the queued commands to the UART, as many as fit into the window of commands awaiting a reply.
+  void send_queued_();
+  /// Match a reply from the Nextion to the oldest command awaiting one.
+  void process_reply_(bool success);
+  /// Forget the commands awaiting a reply, for example after a timeout.
+  void clear_in_flight_();
+  /// Send the sync command, replies are discarded until it was answered.
+  void start_sync_();
+  /// Write a command with its terminator to the UART, returns the time at which the Nextion has received it.
+  uint32_t write_command_(const std::string &command);
+  /// Handle a restart of the Nextion, which resets all components and settings.
+  void handle_restart_();
+  /// Count a failed command and forget the state of the attribute it assigned.
+  void forget_display_state_(const std::string &key);
+  /// Get the last command sent for an attribute, nullptr if unknown.
+  std::string *get_display_state_(const std::string &key);
+  void read_replies_();
 
   std::vector<NextionTouchComponent *> touch_;
   optional<nextion_writer_t> writer_;
   bool wait_for_ack_{true};
+  std::deque<NextionCommand> queue_;
+  std::deque<NextionCommand> in_flight_;
+  /// Whether replies are discarded until the reply to the sync command with sync_id_ arrives.
+  bool syncing_{false};
+  uint32_t sync_id_{0};
+  uint32_t sync_timeout_at_{0};
+  /// Time at which the UART has sent everything written to it so far.
+  uint32_t tx_done_at_{0};
+  /// The last command sent for every attribute, removed again if the Nextion reported an error for it.
+  std::vector<std::pair<std::string, std::string>> display_state_;
+  uint32_t commands_sent_{0};
+  uint32_t commands_skipped_{0};
+  uint32_t commands_failed_{0};
 };
 
 class NextionTouchComponent : public binary_sensor::BinarySensor {
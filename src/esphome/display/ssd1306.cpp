@@ -5,6 +5,8 @@
 #include "esphome/display/ssd1306.h"
 #include "esphome/log.h"
 
+#include <pgmspace.h>
+
 ESPHOME_NAMESPACE_BEGIN
 
 namespace display {
@@ -33,8 +35,13 @@ static const uint8_t SSD1306_COMMAND_PAGE_ADDRESS = 0x22;
 
 static const uint8_t SSD1306_NORMAL_DISPLAY = 0xA6;
 
+/// Change tracking granularity in columns of a page, 16 byte slices need 256 bytes of hashes for 128x64.
+static const uint8_t SSD1306_SEGMENT_LENGTH = 16;
+
 void SSD1306::setup() {
   this->init_internal_(this->get_buffer_length_());
+  this->init_change_tracking_(this->get_buffer_length_(), SSD1306_SEGMENT_LENGTH);
+  this->init_render_task_();
 
   this->command(SSD1306_COMMAND_DISPLAY_OFF);
   this->command(SSD1306_COMMAND_SET_DISPLAY_CLOCK_DIV);
@@ -114,38 +121,61 @@ void SSD1306::setup() {
   this->command(SSD1306_COMMAND_DISPLAY_ON);
 }
 void SSD1306::display() {
-  if (this->is_sh1106_()) {
-    this->write_display_data();
-    return;
-  }
-
-  this->command(SSD1306_COMMAND_COLUMN_ADDRESS);
-  switch (this->model_) {
-    case SSD1306_MODEL_64_48:
-      this->command(0x20);
-      this->command(0x20 + this->get_width_internal() - 1);
-      break;
-    default:
-      this->command(0);  // Page start address, 0
-      this->command(this->get_width_internal() - 1);
-      break;
+  const uint8_t width = this->get_width_internal();
+  const uint8_t pages = this->get_height_internal() / 8;
+  const uint8_t segments_per_page = width / SSD1306_SEGMENT_LENGTH;
+  uint32_t bytes = 0;
+  for (uint8_t page = 0; page < pages; page++) {
+    // find the columns of this page that changed, unchanged segments in between are sent too
+    int first = -1;
+    int last = -1;
+    for (uint8_t segment = 0; segment < segments_per_page; segment++) {
+      if (!this->check_segment_changed_(page * segments_per_page + segment))
+        continue;
+      if (first < 0)
+        first = segment;
+      last = segment;
+    }
+    if (first < 0)
+      continue;
+
+    const uint8_t start = first * SSD1306_SEGMENT_LENGTH;
+    const uint8_t end = (last + 1) * SSD1306_SEGMENT_LENGTH - 1;
+    if (this->is_sh1106_()) {
+      // SH1106 RAM is 132 columns wide, the visible area starts at column 2
+      this->command(0xB0 + page);                   // page
+      this->command(0x00 | ((start + 2) & 0x0F));  // lower column
+      this->command(0x10 | ((start + 2) >> 4));    // higher column
+    } else {
+      const uint8_t offset = this->model_ == SSD1306_MODEL_64_48 ? 0x20 : 0x00;
+      this->command(SSD1306_COMMAND_COLUMN_ADDRESS);
+      this->command(offset + start);
+      this->command(offset + end);
+      this->command(SSD1306_COMMAND_PAGE_ADDRESS);
+      this->command(page);
+      this->command(page);
+    }
+    const uint8_t len = end - start + 1;
+    this->write_display_data(this->buffer_ + page * width + start, len);
+    bytes += len;
   }
-
-  this->command(SSD1306_COMMAND_PAGE_ADDRESS);
-  // Page start address, 0
-  this->command(0);
-  // Page end address:
-  this->command((this->get_height_internal() / 8) - 1);
-
-  this->write_display_data();
+  this->set_bytes_transferred_(bytes);
+  ESP_LOGV(TAG, "Update sent %u bytes.", bytes);
 }
 bool SSD1306::is_sh1106_() const {
   return this->model_ == SH1106_MODEL_96_16 || this->model_ == SH1106_MODEL_128_32 ||
          this->model_ == SH1106_MODEL_128_64;
 }
 void SSD1306::update() {
-  this->do_update_();
-  this->display();
+  if (!this->should_render_())
+    return;
+  if (this->do_update_())
+    this->display();
+}
+void SSD1306::loop() {
+  // transfer the frame once it was rendered in the background
+  if (this->check_render_done_())
+    this->display();
 }
 void SSD1306::set_model(SSD1306Model model) { this->model_ = model; }
 void SSD1306::set_reset_pin(const GPIOOutputPin &reset_pin) { this->reset_pin_ = reset_pin.copy(); }
@@ -202,8 +232,61 @@ void HOT SSD1306::draw_absolute_pixel_internal(int x, int y, int color) {
     this->buffer_[pos] &= ~(1 << subpos);
   }
 }
+void HOT SSD1306::draw_absolute_horizontal_line_internal(int x, int y, int width, int color) {
+  // all pixels are in the same bit of consecutive bytes
+  uint8_t *pos = this->buffer_ + x + (y / 8) * this->get_width_internal();
+  const uint8_t mask = 1 << (y & 0x07);
+  for (int i = 0; i < width; i++) {
+    if (color)
+      pos[i] |= mask;
+    else
+      pos[i] &= ~mask;
+  }
+}
+void HOT SSD1306::draw_absolute_vertical_line_internal(int x, int y, int height, int color) {
+  // set up to 8 pixels (one page) per byte
+  const int width = this->get_width_internal();
+  const int end = y + height;
+  while (y < end) {
+    const int first_bit = y & 0x07;
+    const int bits = std::min(8 - first_bit, end - y);
+    const uint8_t mask = ((1 << bits) - 1) << first_bit;
+    uint8_t &pos = this->buffer_[x + (y / 8) * width];
+    if (color)
+      pos |= mask;
+    else
+      pos &= ~mask;
+    y += bits;
+  }
+}
+bool HOT SSD1306::draw_absolute_bitmap_internal(int x, int y, const uint8_t *data, int width, int height, int color,
+                                                bool draw_background) {
+  const uint32_t stride = (width + 7u) / 8u;
+  for (int row = 0; row < height; row++) {
+    // every row of the bitmap is one bit in consecutive bytes of the buffer
+    uint8_t *pos = this->buffer_ + x + ((y + row) / 8) * this->get_width_internal();
+    const uint8_t mask = 1 << ((y + row) & 0x07);
+    const uint8_t *row_data = data + row * stride;
+    for (int col = 0; col < width; col += 8) {
+      const uint8_t byte = pgm_read_byte(row_data + col / 8);
+      if (byte == 0 && !draw_background)
+        continue;
+      const int bits = std::min(8, width - col);
+      for (int bit = 0; bit < bits; bit++) {
+        const bool set = byte & (0x80 >> bit);
+        if (!set && !draw_background)
+          continue;
+        if (set && color)
+          pos[col + bit] |= mask;
+        else
+          pos[col + bit] &= ~mask;
+      }
+    }
+  }
+  return true;
+}
 float SSD1306::get_setup_priority() const { return setup_priority::POST_HARDWARE; }
-void SSD1306::fill(int color) {
+void SSD1306::fill_internal_(int color) {
   uint8_t fill = color ? 0xFF : 0x00;
   for (uint32_t i = 0; i < this->get_buffer_length_(); i++)
     this->buffer_[i] = fill;
@@ -268,24 +351,18 @@ void SPISSD1306::command(uint8_t value) {
   this->write_byte(value);
   this->disable();
 }
-void HOT SPISSD1306::write_display_data() {
+void HOT SPISSD1306::write_display_data(uint8_t *data, size_t len) {
+  this->dc_pin_->digital_write(true);
   if (this->is_sh1106_()) {
-    for (uint8_t y = 0; y < this->get_height_internal() / 8; y++) {
-      this->command(0xB0 + y);
-      this->command(0x02);
-      this->command(0x10);
-      this->dc_pin_->digital_write(true);
-      for (uint8_t x = 0; x < this->get_width_internal(); x++) {
-        this->enable();
-        this->write_byte(this->buffer_[x + y * this->get_width_internal()]);
-        this->disable();
-        feed_wdt();
-      }
+    for (size_t i = 0; i < len; i++) {
+      this->enable();
+      this->write_byte(data[i]);
+      this->disable();
+      feed_wdt();
     }
   } else {
-    this->dc_pin_->digital_write(true);
     this->enable();
-    this->write_array(this->buffer_, this->get_buffer_length_());
+    this->write_array(data, len);
     this->disable();
   }
 }
@@ -321,27 +398,14 @@ void I2CSSD1306::dump_config() {
   }
 }
 void I2CSSD1306::command(uint8_t value) { this->write_byte(0x00, value); }
-void HOT I2CSSD1306::write_display_data() {
-  if (this->is_sh1106_()) {
-    uint32_t i = 0;
-    for (uint8_t page = 0; page < this->get_height_internal() / 8; page++) {
-      this->command(0xB0 + page);  // row
-      this->command(0x02);         // lower column
-      this->command(0x10);         // higher column
-
-      for (uint8_t x = 0; x < this->get_width_internal() / 16; x++) {
-        uint8_t data[16];
-        for (uint8_t &j : data)
-          j = this->buffer_[i++];
-        this->write_bytes(0x40, data, sizeof(data));
-      }
-    }
-  } else {
-    for (uint32_t i = 0; i < this->get_buffer_length_();) {
-      uint8_t data[16];
-      for (uint8_t &j : data)
-        j = this->buffer_[i++];
-      this->write_bytes(0x40, data, sizeof(data));
+void HOT I2CSSD1306::write_display_data(uint8_t *data, size_t len) {
+  // send in chunks of 16 bytes so that they fit into the I2C buffer together with the control byte
+  for (size_t i = 0; i < len; i += 16) {
+    size_t chunk = std::min(len - i, size_t(16));
+    if (!this->write_bytes(0x40, data + i, chunk)) {
+      // the display RAM is now out of sync with the change tracking, send everything again next time
+      this->invalidate_change_tracking_();
+      return;
     }
   }
 }
@@ -33,22 +33,28 @@ class SSD1306 : public PollingComponent, public DisplayBuffer {
   void display();
 
   void update() override;
+  void loop() override;
 
   void set_model(SSD1306Model model);
   void set_reset_pin(const GPIOOutputPin &reset_pin);
   void set_external_vcc(bool external_vcc);
 
   float get_setup_priority() const override;
-  void fill(int color) override;
 
  protected:
   virtual void command(uint8_t value) = 0;
-  virtual void write_display_data() = 0;
+  /// Write len bytes of display data at the current column/page address.
+  virtual void write_display_data(uint8_t *data, size_t len) = 0;
   void init_reset_();
 
   bool is_sh1106_() const;
 
+  void fill_internal_(int color) override;
   void draw_absolute_pixel_internal(int x, int y, int color) override;
+  void draw_absolute_horizontal_line_internal(int x, int y, int width, int color) override;
+  void draw_absolute_vertical_line_internal(int x, int y, int height, int color) override;
+  bool draw_absolute_bitmap_internal(int x, int y, const uint8_t *data, int width, int height, int color,
+                                     bool draw_background) override;
 
   int get_height_internal() override;
   int get_width_internal() override;
@@ -72,7 +78,7 @@ class SPISSD1306 : public SSD1306, public SPIDevice {
  protected:
   void command(uint8_t value) override;
 
-  void write_display_data() override;
+  void write_display_data(uint8_t *data, size_t len) override;
   bool is_device_msb_first() override;
   bool is_device_high_speed() override;
 
@@ -89,7 +95,7 @@ class I2CSSD1306 : public SSD1306, public I2CDevice {
 
  protected:
   void command(uint8_t value) override;
-  void write_display_data() override;
+  void write_display_data(uint8_t *data, size_t len) override;
 
   enum ErrorCode { NONE = 0, COMMUNICATION_FAILED } error_code_{NONE};
 };
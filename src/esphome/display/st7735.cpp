@@ -0,0 +1,198 @@
+#include "esphome/defines.h"
+
+#ifdef USE_ST7735
+
+#include "esphome/display/st7735.h"
+#include "esphome/log.h"
+
+ESPHOME_NAMESPACE_BEGIN
+
+namespace display {
+
+static const char *TAG = "display.st7735";
+
+static const uint8_t ST7735_SWRESET = 0x01;
+static const uint8_t ST7735_SLPOUT = 0x11;
+static const uint8_t ST7735_NORON = 0x13;
+static const uint8_t ST7735_INVOFF = 0x20;
+static const uint8_t ST7735_DISPON = 0x29;
+static const uint8_t ST7735_CASET = 0x2A;
+static const uint8_t ST7735_RASET = 0x2B;
+static const uint8_t ST7735_RAMWR = 0x2C;
+static const uint8_t ST7735_MADCTL = 0x36;
+static const uint8_t ST7735_COLMOD = 0x3A;
+
+/// Initialization of the ST7735R: command, number of data bytes, data.
+static const uint8_t ST7735_INIT_SEQUENCE[] = {
+    0xB1, 3, 0x01, 0x2C, 0x2D,                    // frame rate control, normal mode
+    0xB2, 3, 0x01, 0x2C, 0x2D,                    // frame rate control, idle mode
+    0xB3, 6, 0x01, 0x2C, 0x2D, 0x01, 0x2C, 0x2D,  // frame rate control, partial mode
+    0xB4, 1, 0x07,                                // no display inversion
+    0xC0, 3, 0xA2, 0x02, 0x84,                    // power control 1, -4.6V, auto mode
+    0xC1, 1, 0xC5,                                // power control 2, VGH25 2.4C, VGSEL -10, VGH = 3 * AVDD
+    0xC2, 2, 0x0A, 0x00,                          // power control 3, opamp current small, boost frequency
+    0xC3, 2, 0x8A, 0x2A,                          // power control 4, BCLK / 2
+    0xC4, 2, 0x8A, 0xEE,                          // power control 5
+    0xC5, 1, 0x0E,                                // VCOM control
+    ST7735_INVOFF, 0,                             // display inversion off
+    ST7735_MADCTL, 1, 0xC8,                       // row/column address order for the rotation of the panel, BGR
+    ST7735_COLMOD, 1, 0x05,                       // 16 bits per pixel
+    // positive gamma correction
+    0xE0, 16, 0x02, 0x1C, 0x07, 0x12, 0x37, 0x32, 0x29, 0x2D, 0x29, 0x25, 0x2B, 0x39, 0x00, 0x01, 0x03, 0x10,
+    // negative gamma correction
+    0xE1, 16, 0x03, 0x1D, 0x07, 0x06, 0x2E, 0x2C, 0x29, 0x2D, 0x2E, 0x2E, 0x37, 0x3F, 0x00, 0x00, 0x02, 0x10,
+};
+
+ST7735::ST7735(SPIComponent *parent, GPIOPin *cs, GPIOPin *dc_pin, ST7735Model model, uint32_t update_interval)
+    : PollingComponent(update_interval), SPIDevice(parent, cs), dc_pin_(dc_pin), model_(model) {}
+void ST7735::set_reset_pin(const GPIOOutputPin &reset) { this->reset_pin_ = reset.copy(); }
+void ST7735::setup() {
+  ESP_LOGCONFIG(TAG, "Setting up ST7735...");
+  this->init_framebuffer_();
+  if (this->buffer_ == nullptr) {
+    this->mark_failed();
+    return;
+  }
+  // one segment per row
+  this->init_change_tracking_(this->get_framebuffer_size(), this->stride_);
+  this->init_render_task_();
+
+  this->dc_pin_->setup();  // OUTPUT
+  this->dc_pin_->digital_write(false);
+  if (this->reset_pin_ != nullptr) {
+    this->reset_pin_->setup();  // OUTPUT
+    this->reset_pin_->digital_write(true);
+  }
+  this->spi_setup();
+
+  if (this->reset_pin_ != nullptr) {
+    this->reset_pin_->digital_write(false);
+    delay(10);
+    this->reset_pin_->digital_write(true);
+    delay(120);
+  } else {
+    this->command(ST7735_SWRESET);
+    delay(150);
+  }
+  this->command(ST7735_SLPOUT);
+  delay(255);
+
+  for (uint32_t i = 0; i < sizeof(ST7735_INIT_SEQUENCE);) {
+    this->command(ST7735_INIT_SEQUENCE[i++]);
+    const uint8_t len = ST7735_INIT_SEQUENCE[i++];
+    for (uint8_t j = 0; j < len; j++)
+      this->data(ST7735_INIT_SEQUENCE[i++]);
+  }
+
+  this->command(ST7735_NORON);
+  delay(10);
+  this->command(ST7735_DISPON);
+  delay(100);
+
+  // the display RAM is random after power up
+  this->display();
+}
+void ST7735::dump_config() {
+  LOG_DISPLAY("", "ST7735", this);
+  switch (this->model_) {
+    case ST7735_MODEL_128_160:
+      ESP_LOGCONFIG(TAG, "  Model: 128x160");
+      break;
+    case ST7735_MODEL_128_128:
+      ESP_LOGCONFIG(TAG, "  Model: 128x128");
+      break;
+  }
+  ESP_LOGCONFIG(TAG, "  Framebuffer: %u bpp, %u bytes", BITS_PER_PIXEL, this->get_framebuffer_size());
+  LOG_PIN("  CS Pin: ", this->cs_);
+  LOG_PIN("  DC Pin: ", this->dc_pin_);
+  LOG_PIN("  Reset Pin: ", this->reset_pin_);
+  LOG_UPDATE_INTERVAL(this);
+  if (this->is_failed()) {
+    ESP_LOGE(TAG, "Could not allocate the framebuffer!");
+  }
+}
+float ST7735::get_setup_priority() const { return setup_priority::POST_HARDWARE; }
+void ST7735::update() {
+  if (!this->should_render_())
+    return;
+  if (this->do_update_())
+    this->display();
+}
+void ST7735::loop() {
+  // transfer the frame once it was rendered in the background
+  if (this->check_render_done_())
+    this->display();
+}
+void HOT ST7735::display() {
+  // the display RAM has the layout of the framebuffer, send the rows from the first to the last changed one
+  const uint32_t height = this->get_height_internal();
+  uint32_t first = height;
+  uint32_t last = 0;
+  for (uint32_t row = 0; row < height; row++) {
+    if (!this->check_segment_changed_(row))
+      continue;
+    if (first == height)
+      first = row;
+    last = row;
+  }
+  if (first == height) {
+    this->set_bytes_transferred_(0);
+    return;
+  }
+
+  this->set_address_window_(0, first, this->get_width_internal() - 1, last);
+  const uint32_t bytes = (last - first + 1) * this->stride_;
+  this->dc_pin_->digital_write(true);
+  this->enable();
+  this->write_array(this->buffer_ + first * this->stride_, bytes);
+  this->disable();
+  this->set_bytes_transferred_(bytes);
+  ESP_LOGV(TAG, "Update sent rows %u-%u (%u bytes).", first, last, bytes);
+}
+void ST7735::set_address_window_(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2) {
+  const uint8_t column_offset = this->get_column_offset_();
+  const uint8_t row_offset = this->get_row_offset_();
+  this->command(ST7735_CASET);
+  this->data(0x00);
+  this->data(x1 + column_offset);
+  this->data(0x00);
+  this->data(x2 + column_offset);
+  this->command(ST7735_RASET);
+  this->data(0x00);
+  this->data(y1 + row_offset);
+  this->data(0x00);
+  this->data(y2 + row_offset);
+  this->command(ST7735_RAMWR);
+}
+void ST7735::command(uint8_t value) {
+  this->dc_pin_->digital_write(false);
+  this->enable();
+  this->write_byte(value);
+  this->disable();
+}
+void ST7735::data(uint8_t value) {
+  this->dc_pin_->digital_write(true);
+  this->enable();
+  this->write_byte(value);
+  this->disable();
+}
+int ST7735::get_width_internal() { return 128; }
+int ST7735::get_height_internal() {
+  switch (this->model_) {
+    case ST7735_MODEL_128_128:
+      return 128;
+    case ST7735_MODEL_128_160:
+    default:
+      return 160;
+  }
+}
+uint8_t ST7735::get_column_offset_() const { return this->model_ == ST7735_MODEL_128_128 ? 2 : 0; }
+uint8_t ST7735::get_row_offset_() const { return this->model_ == ST7735_MODEL_128_128 ? 3 : 0; }
+bool ST7735::is_device_msb_first() { return true; }
+bool ST7735::is_device_high_speed() { return true; }
+
+}  // namespace display
+
+ESPHOME_NAMESPACE_END
+
+#endif  // USE_ST7735
@@ -0,0 +1,70 @@
+#ifndef ESPHOME_DISPLAY_ST7735_H
+#define ESPHOME_DISPLAY_ST7735_H
+
+#include "esphome/defines.h"
+
+#ifdef USE_ST7735
+
+#include "esphome/component.h"
+#include "esphome/spi_component.h"
+#include "esphome/display/framebuffer.h"
+
+ESPHOME_NAMESPACE_BEGIN
+
+namespace display {
+
+enum ST7735Model {
+  /// 1.8in 128x160 displays ("red tab").
+  ST7735_MODEL_128_160 = 0,
+  /// 1.44in 128x128 displays ("green tab").
+  ST7735_MODEL_128_128,
+};
+
+/** Driver for ST7735 color TFT displays over SPI, with a RGB565 framebuffer.
+ *
+ * The framebuffer needs 2 bytes per pixel (40kB for 128x160), so this is mostly useful on the ESP32. Only the rows
+ * that changed since the last update are sent. Draw with color_rgb() for colors, COLOR_ON is white.
+ */
+class ST7735 : public PollingComponent, public SPIDevice, public PackedDisplayBuffer<16> {
+ public:
+  ST7735(SPIComponent *parent, GPIOPin *cs, GPIOPin *dc_pin, ST7735Model model, uint32_t update_interval = 1000);
+  void set_reset_pin(const GPIOOutputPin &reset);
+
+  void command(uint8_t value);
+  void data(uint8_t value);
+
+  /// Send the rows that changed since the last call to the display.
+  void display();
+
+  // ========== INTERNAL METHODS ==========
+  // (In most use cases you won't need these)
+  void setup() override;
+  void dump_config() override;
+  float get_setup_priority() const override;
+  void update() override;
+  void loop() override;
+
+ protected:
+  /// Set the window the following pixel data is written to (inclusive), then start writing to the display RAM.
+  void set_address_window_(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2);
+
+  int get_width_internal() override;
+  int get_height_internal() override;
+  uint8_t get_column_offset_() const;
+  uint8_t get_row_offset_() const;
+
+  bool is_device_msb_first() override;
+  bool is_device_high_speed() override;
+
+  GPIOPin *dc_pin_;
+  GPIOPin *reset_pin_{nullptr};
+  ST7735Model model_;
+};
+
+}  // namespace display
+
+ESPHOME_NAMESPACE_END
+
+#endif  // USE_ST7735
+
+#endif  // ESPHOME_DISPLAY_ST7735_H
@@ -5,6 +5,8 @@
 #include "esphome/display/waveshare_epaper.h"
 #include "esphome/log.h"
 
+#include <pgmspace.h>
+
 ESPHOME_NAMESPACE_BEGIN
 
 namespace display {
@@ -44,6 +46,9 @@ static const uint8_t PARTIAL_UPDATE_LUT[30] = {0x10, 0x18, 0x18, 0x08, 0x18, 0x1
 
 void WaveshareEPaper::setup_pins_() {
   this->init_internal_(this->get_buffer_length_());
+  // one segment per row
+  this->init_change_tracking_(this->get_buffer_length_(), this->get_width_internal() / 8u);
+  this->init_render_task_();
   this->dc_pin_->setup();  // OUTPUT
   this->dc_pin_->digital_write(false);
   if (this->reset_pin_ != nullptr) {
@@ -93,10 +98,40 @@ bool WaveshareEPaper::wait_until_idle_() {
 void WaveshareEPaper::set_reset_pin(const GPIOOutputPin &reset) { this->reset_pin_ = reset.copy(); }
 void WaveshareEPaper::set_busy_pin(const GPIOInputPin &busy) { this->busy_pin_ = busy.copy(); }
 void WaveshareEPaper::update() {
-  this->do_update_();
-  this->display();
+  if (!this->should_render_())
+    return;
+  if (this->do_update_())
+    this->display();
+}
+void WaveshareEPaper::loop() {
+  // transfer the frame once it was rendered in the background
+  if (this->check_render_done_())
+    this->display();
+}
+bool WaveshareEPaper::find_changed_rows_(uint32_t *first, uint32_t *last) {
+  const uint32_t height = this->get_height_internal();
+  bool changed = false;
+  for (uint32_t row = 0; row < height; row++) {
+    if (!this->check_segment_changed_(row))
+      continue;
+    if (!changed)
+      *first = row;
+    *last = row;
+    changed = true;
+  }
+  if (!changed) {
+    ESP_LOGV(TAG, "Display content unchanged, skipping update.");
+    this->set_bytes_transferred_(0);
+  }
+  return changed;
 }
-void WaveshareEPaper::fill(int color) {
+void WaveshareEPaper::write_rows_(uint32_t first, uint32_t last) {
+  const uint32_t row_length = this->get_width_internal() / 8u;
+  this->start_data_();
+  this->write_array(this->buffer_ + first * row_length, (last - first + 1) * row_length);
+  this->end_data_();
+}
+void WaveshareEPaper::fill_internal_(int color) {
   // flip logic
   const uint8_t fill = color ? 0x00 : 0xFF;
   for (uint32_t i = 0; i < this->get_buffer_length_(); i++)
@@ -114,6 +149,67 @@ void HOT WaveshareEPaper::draw_absolute_pixel_internal(int x, int y, int color)
   else
     this->buffer_[pos] &= ~(0x80 >> subpos);
 }
+void HOT WaveshareEPaper::draw_absolute_horizontal_line_internal(int x, int y, int width, int color) {
+  // set up to 8 pixels per byte
+  uint8_t *row = this->buffer_ + y * (this->get_width_internal() / 8u);
+  const int end = x + width;
+  while (x < end) {
+    const int first_bit = x & 0x07;
+    const int bits = std::min(8 - first_bit, end - x);
+    const uint8_t mask = (0xFF >> first_bit) & ~(0xFF >> (first_bit + bits));
+    // flip logic
+    if (!color)
+      row[x / 8u] |= mask;
+    else
+      row[x / 8u] &= ~mask;
+    x += bits;
+  }
+}
+void HOT WaveshareEPaper::draw_absolute_vertical_line_internal(int x, int y, int height, int color) {
+  const uint32_t stride = this->get_width_internal() / 8u;
+  uint8_t *pos = this->buffer_ + y * stride + x / 8u;
+  const uint8_t mask = 0x80 >> (x & 0x07);
+  for (int i = 0; i < height; i++, pos += stride) {
+    // flip logic
+    if (!color)
+      *pos |= mask;
+    else
+      *pos &= ~mask;
+  }
+}
+/// Write the pixels of bits selected by mask to a buffer byte.
+static inline void write_bitmap_byte(uint8_t *pos, uint8_t bits, uint8_t mask, int color, bool draw_background) {
+  // flip logic
+  if (draw_background) {
+    // set pixels get color, all others in mask are cleared
+    *pos = (*pos & ~mask) | (mask & ~bits) | (color ? 0x00 : bits);
+  } else if (color) {
+    *pos &= ~bits;
+  } else {
+    *pos |= bits;
+  }
+}
+bool HOT WaveshareEPaper::draw_absolute_bitmap_internal(int x, int y, const uint8_t *data, int width, int height,
+                                                        int color, bool draw_background) {
+  // the bitmap has the same layout as the buffer, each byte just has to be shifted into place
+  const uint32_t stride = this->get_width_internal() / 8u;
+  const uint32_t data_stride = (width + 7u) / 8u;
+  const uint8_t shift = x & 0x07;
+  for (int row = 0; row < height; row++) {
+    uint8_t *pos = this->buffer_ + (y + row) * stride + x / 8u;
+    const uint8_t *row_data = data + row * data_stride;
+    for (uint32_t i = 0; i < data_stride; i++) {
+      const int remaining = width - int(i) * 8;
+      const uint8_t mask = remaining >= 8 ? 0xFF : uint8_t(0xFF << (8 - remaining));
+      const uint8_t bits = pgm_read_byte(row_data + i) & mask;
+      write_bitmap_byte(pos + i, bits >> shift, mask >> shift, color, draw_background);
+      const auto next_mask = uint8_t(mask << (8 - shift));
+      if (shift != 0 && next_mask != 0)
+        write_bitmap_byte(pos + i + 1, bits << (8 - shift), next_mask, color, draw_background);
+    }
+  }
+  return true;
+}
 uint32_t WaveshareEPaper::get_buffer_length_() { return this->get_width_internal() * this->get_height_internal() / 8u; }
 WaveshareEPaper::WaveshareEPaper(SPIComponent *parent, GPIOPin *cs, GPIOPin *dc_pin, uint32_t update_interval)
     : PollingComponent(update_interval), SPIDevice(parent, cs), dc_pin_(dc_pin) {}
@@ -178,7 +274,12 @@ void WaveshareEPaperTypeA::dump_config() {
   LOG_UPDATE_INTERVAL(this);
 }
 void HOT WaveshareEPaperTypeA::display() {
+  uint32_t first_row, last_row;
+  if (!this->find_changed_rows_(&first_row, &last_row))
+    return;
+
   if (!this->wait_until_idle_()) {
+    this->invalidate_change_tracking_();
     this->status_set_warning();
     return;
   }
@@ -209,14 +310,16 @@ void HOT WaveshareEPaperTypeA::display() {
   this->data(0x00);
 
   if (!this->wait_until_idle_()) {
+    this->invalidate_change_tracking_();
     this->status_set_warning();
     return;
   }
 
+  // The controller switches between two RAM buffers on every update, so even if only a few rows changed the
+  // whole frame has to be written.
   this->command(WAVESHARE_EPAPER_COMMAND_WRITE_RAM);
-  this->start_data_();
-  this->write_array(this->buffer_, this->get_buffer_length_());
-  this->end_data_();
+  this->write_rows_(0, this->get_height_internal() - 1);
+  this->set_bytes_transferred_(this->get_buffer_length_());
 
   this->command(WAVESHARE_EPAPER_COMMAND_DISPLAY_UPDATE_CONTROL_2);
   this->data(0xC4);
@@ -275,8 +378,8 @@ static const uint8_t WAVESHARE_EPAPER_B_COMMAND_DATA_START_TRANSMISSION_1 = 0x10
 // static const uint8_t WAVESHARE_EPAPER_B_COMMAND_DATA_STOP = 0x11;
 static const uint8_t WAVESHARE_EPAPER_B_COMMAND_DISPLAY_REFRESH = 0x12;
 static const uint8_t WAVESHARE_EPAPER_B_COMMAND_DATA_START_TRANSMISSION_2 = 0x13;
-// static const uint8_t WAVESHARE_EPAPER_B_COMMAND_PARTIAL_DATA_START_TRANSMISSION_1 = 0x14;
-// static const uint8_t WAVESHARE_EPAPER_B_COMMAND_PARTIAL_DATA_START_TRANSMISSION_2 = 0x15;
+static const uint8_t WAVESHARE_EPAPER_B_COMMAND_PARTIAL_DATA_START_TRANSMISSION_1 = 0x14;
+static const uint8_t WAVESHARE_EPAPER_B_COMMAND_PARTIAL_DATA_START_TRANSMISSION_2 = 0x15;
 static const uint8_t WAVESHARE_EPAPER_B_COMMAND_PARTIAL_DISPLAY_REFRESH = 0x16;
 static const uint8_t WAVESHARE_EPAPER_B_COMMAND_LUT_FOR_VCOM = 0x20;
 static const uint8_t WAVESHARE_EPAPER_B_COMMAND_LUT_WHITE_TO_WHITE = 0x21;
@@ -296,9 +399,9 @@ static const uint8_t WAVESHARE_EPAPER_B_COMMAND_RESOLUTION_SETTING = 0x61;
 // static const uint8_t WAVESHARE_EPAPER_B_COMMAND_AUTO_MEASURE_VCOM = 0x80;
 // static const uint8_t WAVESHARE_EPAPER_B_COMMAND_VCOM_VALUE = 0x81;
 static const uint8_t WAVESHARE_EPAPER_B_COMMAND_VCM_DC_SETTING_REGISTER = 0x82;
-// static const uint8_t WAVESHARE_EPAPER_B_COMMAND_PARTIAL_WINDOW = 0x90;
-// static const uint8_t WAVESHARE_EPAPER_B_COMMAND_PARTIAL_IN = 0x91;
-// static const uint8_t WAVESHARE_EPAPER_B_COMMAND_PARTIAL_OUT = 0x92;
+static const uint8_t WAVESHARE_EPAPER_B_COMMAND_PARTIAL_WINDOW = 0x90;
+static const uint8_t WAVESHARE_EPAPER_B_COMMAND_PARTIAL_IN = 0x91;
+static const uint8_t WAVESHARE_EPAPER_B_COMMAND_PARTIAL_OUT = 0x92;
 // static const uint8_t WAVESHARE_EPAPER_B_COMMAND_PROGRAM_MODE = 0xA0;
 // static const uint8_t WAVESHARE_EPAPER_B_COMMAND_ACTIVE_PROGRAM = 0xA1;
 // static const uint8_t WAVESHARE_EPAPER_B_COMMAND_READ_OTP_DATA = 0xA2;
@@ -405,7 +508,24 @@ void WaveshareEPaper2P7In::setup() {
     this->data(i);
 }
 void HOT WaveshareEPaper2P7In::display() {
-  // TODO check active frame buffer to only transmit once / use partial transmits
+  uint32_t first_row, last_row;
+  if (!this->find_changed_rows_(&first_row, &last_row))
+    return;
+  const uint32_t row_length = this->get_width_internal() / 8u;
+  const uint32_t rows = last_row - first_row + 1;
+  if (rows != uint32_t(this->get_height_internal())) {
+    // only transmit and refresh the changed rows
+    this->write_partial_window_(WAVESHARE_EPAPER_B_COMMAND_PARTIAL_DATA_START_TRANSMISSION_1, first_row, rows);
+    this->write_rows_(first_row, last_row);
+    delay(2);
+    this->write_partial_window_(WAVESHARE_EPAPER_B_COMMAND_PARTIAL_DATA_START_TRANSMISSION_2, first_row, rows);
+    this->write_rows_(first_row, last_row);
+    delay(2);
+    this->write_partial_window_(WAVESHARE_EPAPER_B_COMMAND_PARTIAL_DISPLAY_REFRESH, first_row, rows);
+    this->set_bytes_transferred_(2 * rows * row_length);
+    return;
+  }
+
   this->command(WAVESHARE_EPAPER_B_COMMAND_DATA_START_TRANSMISSION_1);
   delay(2);
   this->start_data_();
@@ -418,6 +538,20 @@ void HOT WaveshareEPaper2P7In::display() {
   this->write_array(this->buffer_, this->get_buffer_length_());
   this->end_data_();
   this->command(WAVESHARE_EPAPER_B_COMMAND_DISPLAY_REFRESH);
+  this->set_bytes_transferred_(2 * this->get_buffer_length_());
+}
+void WaveshareEPaper2P7In::write_partial_window_(uint8_t command, uint32_t first_row, uint32_t rows) {
+  const uint16_t width = this->get_width_internal();
+  this->command(command);
+  this->data(0x00);  // x start, multiple of 8
+  this->data(0x00);
+  this->data(first_row >> 8);  // y start
+  this->data(first_row & 0xFF);
+  this->data(width >> 8);  // width, multiple of 8
+  this->data(width & 0xF8);
+  this->data(rows >> 8);  // height
+  this->data(rows & 0xFF);
+  delay(2);
 }
 int WaveshareEPaper2P7In::get_width_internal() { return 176; }
 int WaveshareEPaper2P7In::get_height_internal() { return 264; }
@@ -502,6 +636,10 @@ void WaveshareEPaper4P2In::setup() {
     this->data(i);
 }
 void HOT WaveshareEPaper4P2In::display() {
+  uint32_t first_row, last_row;
+  if (!this->find_changed_rows_(&first_row, &last_row))
+    return;
+
   this->command(WAVESHARE_EPAPER_B_COMMAND_RESOLUTION_SETTING);
   this->data(0x01);
   this->data(0x90);
@@ -514,7 +652,36 @@ void HOT WaveshareEPaper4P2In::display() {
   this->command(WAVESHARE_EPAPER_B_COMMAND_VCOM_AND_DATA_INTERVAL_SETTING);
   this->data(0x97);
 
-  // TODO check active frame buffer to only transmit once / use partial transmits
+  const uint32_t row_length = this->get_width_internal() / 8u;
+  const uint32_t rows = last_row - first_row + 1;
+  if (rows != uint32_t(this->get_height_internal())) {
+    // only transmit and refresh the changed rows
+    const uint16_t x_end = this->get_width_internal() - 1;
+    this->command(WAVESHARE_EPAPER_B_COMMAND_PARTIAL_IN);
+    this->command(WAVESHARE_EPAPER_B_COMMAND_PARTIAL_WINDOW);
+    this->data(0x00);  // x start, multiple of 8
+    this->data(0x00);
+    this->data(x_end >> 8);  // x end, multiple of 8 minus 1
+    this->data(x_end & 0xFF);
+    this->data(first_row >> 8);  // y start
+    this->data(first_row & 0xFF);
+    this->data(last_row >> 8);  // y end
+    this->data(last_row & 0xFF);
+    this->data(0x01);  // gates scan both inside and outside of the window
+    delay(2);
+    this->command(WAVESHARE_EPAPER_B_COMMAND_DATA_START_TRANSMISSION_1);
+    delay(2);
+    this->write_rows_(first_row, last_row);
+    delay(2);
+    this->command(WAVESHARE_EPAPER_B_COMMAND_DATA_START_TRANSMISSION_2);
+    delay(2);
+    this->write_rows_(first_row, last_row);
+    this->command(WAVESHARE_EPAPER_B_COMMAND_DISPLAY_REFRESH);
+    this->command(WAVESHARE_EPAPER_B_COMMAND_PARTIAL_OUT);
+    this->set_bytes_transferred_(2 * rows * row_length);
+    return;
+  }
+
   this->command(WAVESHARE_EPAPER_B_COMMAND_DATA_START_TRANSMISSION_1);
   delay(2);
   this->start_data_();
@@ -527,6 +694,7 @@ void HOT WaveshareEPaper4P2In::display() {
   this->write_array(this->buffer_, this->get_buffer_length_());
   this->end_data_();
   this->command(WAVESHARE_EPAPER_B_COMMAND_DISPLAY_REFRESH);
+  this->set_bytes_transferred_(2 * this->get_buffer_length_());
 }
 int WaveshareEPaper4P2In::get_width_internal() { return 400; }
 int WaveshareEPaper4P2In::get_height_internal() { return 300; }
@@ -587,6 +755,10 @@ void WaveshareEPaper7P5In::setup() {
   this->data(0x03);
 }
 void HOT WaveshareEPaper7P5In::display() {
+  uint32_t first_row, last_row;
+  if (!this->find_changed_rows_(&first_row, &last_row))
+    return;
+
   this->command(WAVESHARE_EPAPER_B_COMMAND_DATA_START_TRANSMISSION_1);
 
   this->start_data_();
@@ -615,6 +787,7 @@ void HOT WaveshareEPaper7P5In::display() {
   this->end_data_();
 
   this->command(WAVESHARE_EPAPER_B_COMMAND_DISPLAY_REFRESH);
+  this->set_bytes_transferred_(4 * this->get_buffer_length_());
 }
 int WaveshareEPaper7P5In::get_width_internal() { return 640; }
 int WaveshareEPaper7P5In::get_height_internal() { return 384; }
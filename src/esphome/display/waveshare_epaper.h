@@ -26,11 +26,16 @@ class WaveshareEPaper : public PollingComponent, public SPIDevice, public Displa
   virtual void display() = 0;
 
   void update() override;
+  void loop() override;
 
-  void fill(int color) override;
 
  protected:
+  void fill_internal_(int color) override;
   void draw_absolute_pixel_internal(int x, int y, int color) override;
+  void draw_absolute_horizontal_line_internal(int x, int y, int width, int color) override;
+  void draw_absolute_vertical_line_internal(int x, int y, int height, int color) override;
+  bool draw_absolute_bitmap_internal(int x, int y, const uint8_t *data, int width, int height, int color,
+                                     bool draw_background) override;
 
   bool wait_until_idle_();
 
@@ -38,6 +43,15 @@ class WaveshareEPaper : public PollingComponent, public SPIDevice, public Displa
 
   uint32_t get_buffer_length_();
 
+  /** Find the rows that changed since the last update.
+   *
+   * @return false if nothing changed, then the update can be skipped.
+   */
+  bool find_changed_rows_(uint32_t *first, uint32_t *last);
+
+  /// Write the rows first to last (inclusive) of the buffer as data.
+  void write_rows_(uint32_t first, uint32_t last);
+
   bool is_device_high_speed() override;
 
   void start_command_();
@@ -97,6 +111,9 @@ class WaveshareEPaper2P7In : public WaveshareEPaper {
   void dump_config() override;
 
  protected:
+  /// Send a partial window command (transmission or refresh) for rows starting at first_row over the full width.
+  void write_partial_window_(uint8_t command, uint32_t first_row, uint32_t rows);
+
   int get_width_internal() override;
 
   int get_height_internal() override;
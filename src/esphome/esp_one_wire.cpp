@@ -24,6 +24,7 @@ bool HOT ESPOneWire::reset() {
   } while (!this->pin_->digital_read());
 
   // Send 480µs LOW TX reset pulse
+  disable_interrupts();
   this->pin_->pin_mode(OUTPUT);
   this->pin_->digital_write(false);
   delayMicroseconds(480);
@@ -35,11 +36,14 @@ bool HOT ESPOneWire::reset() {
   delayMicroseconds(70);
 
   bool r = !this->pin_->digital_read();
+  enable_interrupts();
   delayMicroseconds(410);
   return r;
 }
 
 void HOT ESPOneWire::write_bit(bool bit) {
+  // Only the slot itself is timing critical, interrupts may be serviced between slots.
+  disable_interrupts();
   // Initiate write/read by pulling low.
   this->pin_->pin_mode(OUTPUT);
   this->pin_->digital_write(false);
@@ -49,18 +53,21 @@ void HOT ESPOneWire::write_bit(bool bit) {
     // pull high/release within 15µs
     delayMicroseconds(10);
     this->pin_->digital_write(true);
+    enable_interrupts();
     // in total minimum of 60µs long
     delayMicroseconds(55);
   } else {
     // continue pulling LOW for at least 60µs
     delayMicroseconds(65);
     this->pin_->digital_write(true);
+    enable_interrupts();
     // grace period, 1µs recovery time
     delayMicroseconds(5);
   }
 }
 
 bool HOT ESPOneWire::read_bit() {
+  disable_interrupts();
   // Initiate read slot by pulling LOW for at least 1µs
   this->pin_->pin_mode(OUTPUT);
   this->pin_->digital_write(false);
@@ -71,6 +78,7 @@ bool HOT ESPOneWire::read_bit() {
   delayMicroseconds(10);
 
   bool r = this->pin_->digital_read();
+  enable_interrupts();
   // read time slot at least 60µs long + 1µs recovery time between slots
   delayMicroseconds(53);
   return r;
@@ -88,6 +96,12 @@ void ESPOneWire::write64(uint64_t val) {
   }
 }
 
+void ESPOneWire::write_bytes(const uint8_t *data, size_t len) {
+  for (size_t i = 0; i < len; i++) {
+    this->write8(data[i]);
+  }
+}
+
 uint8_t ESPOneWire::read8() {
   uint8_t ret = 0;
   for (uint8_t i = 0; i < 8; i++) {
@@ -102,6 +116,11 @@ uint64_t ESPOneWire::read64() {
   }
   return ret;
 }
+void ESPOneWire::read_bytes(uint8_t *data, size_t len) {
+  for (size_t i = 0; i < len; i++) {
+    data[i] = this->read8();
+  }
+}
 void ESPOneWire::select(uint64_t address) {
   this->write8(ONE_WIRE_ROM_SELECT);
   this->write64(address);
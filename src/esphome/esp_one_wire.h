@@ -17,6 +17,10 @@ extern const int ONE_WIRE_ROM_SEARCH;
  *
  * It's more or less the same as Arduino's internal library but uses some fancy C++ and 64 bit
  * unsigned integers to make our lives easier.
+ *
+ * Interrupts are only disabled within the timing-critical part of each individual time slot, so
+ * interrupts (WiFi etc.) can be serviced between slots. Callers must therefore NOT disable interrupts
+ * around whole transactions.
  */
 class ESPOneWire {
  public:
@@ -40,6 +44,9 @@ class ESPOneWire {
   /// Write a word to the bus. LSB first.
   void write8(uint8_t val);
 
+  /// Write len bytes from data to the bus.
+  void write_bytes(const uint8_t *data, size_t len);
+
   /// Write a 64 bit unsigned integer to the bus. LSB first.
   void write64(uint64_t val);
 
@@ -52,6 +59,9 @@ class ESPOneWire {
   /// Read an 64-bit unsigned integer from the bus.
   uint64_t read64();
 
+  /// Read len bytes from the bus into data.
+  void read_bytes(uint8_t *data, size_t len);
+
   /// Select a specific address on the bus for the following command.
   void select(uint64_t address);
 
@@ -31,6 +31,7 @@ bool ESPPreferenceObject::load_() {
     return false;
 
   bool valid = this->data_[this->length_words_] == this->calculate_crc_();
+  this->in_sync_ = valid;
 
   ESP_LOGVV(TAG, "LOAD %zu: valid=%s, 0=0x%08X 1=0x%08X (Type=%u, CRC=0x%08X)", this->rtc_offset_, YESNO(valid),
             this->data_[0], this->data_[1], this->type_, this->calculate_crc_());
@@ -42,13 +43,22 @@ bool ESPPreferenceObject::save_() {
     return false;
   }
 
+  global_preferences.save_count_++;
   this->data_[this->length_words_] = this->calculate_crc_();
-  if (!this->save_internal_())
+  this->in_sync_ = this->save_internal_();
+  if (!this->in_sync_)
     return false;
   ESP_LOGVV(TAG, "SAVE %zu: 0=0x%08X 1=0x%08X (Type=%u, CRC=0x%08X)", this->rtc_offset_, this->data_[0], this->data_[1],
             this->type_, this->calculate_crc_());
   return true;
 }
+bool ESPPreferenceObject::save_unchanged_() {
+  global_preferences.save_count_++;
+  global_preferences.unchanged_count_++;
+  ESP_LOGVV(TAG, "SAVE %zu: unchanged", this->rtc_offset_);
+  return true;
+}
+void ESPPreferenceObject::set_write_delay(uint32_t write_delay) { this->write_delay_ = write_delay; }
 
 #ifdef ARDUINO_ARCH_ESP8266
 
@@ -56,6 +66,9 @@ bool ESPPreferenceObject::save_() {
 #define ESP_RTC_USER_MEM ((uint32_t *) ESP_RTC_USER_MEM_START)
 #define ESP_RTC_USER_MEM_SIZE_WORDS 128
 #define ESP_RTC_USER_MEM_SIZE_BYTES ESP_RTC_USER_MEM_SIZE_WORDS * 4
+// the first 32 words of user RTC memory are used by eboot for the OTA command
+#define ESP_RTC_EBOOT_SIZE_WORDS 32
+#define ESP_RTC_EBOOT_SIZE_BYTES ESP_RTC_EBOOT_SIZE_WORDS * 4
 
 static inline bool esp_rtc_user_mem_read(uint32_t index, uint32_t *dest) {
   if (index >= ESP_RTC_USER_MEM_SIZE_WORDS) {
@@ -73,7 +86,7 @@ static inline bool esp_rtc_user_mem_write(uint32_t index, uint32_t value) {
   if (index >= ESP_RTC_USER_MEM_SIZE_WORDS) {
     return false;
   }
-  if (index < 32 && global_preferences.is_prevent_write()) {
+  if (index < ESP_RTC_EBOOT_SIZE_WORDS && global_preferences.is_prevent_write()) {
     return false;
   }
 
@@ -95,13 +108,16 @@ static const uint32_t get_esp8266_flash_address() { return get_esp8266_flash_sec
 
 static void load_esp8266_flash() {
   ESP_LOGVV(TAG, "Loading preferences from flash...");
+  // never restore the eboot words, a stale OTA command would flash the device again on the next reboot
   disable_interrupts();
-  spi_flash_read(get_esp8266_flash_address(), ESP_RTC_USER_MEM, ESP_RTC_USER_MEM_SIZE_BYTES);
+  spi_flash_read(get_esp8266_flash_address() + ESP_RTC_EBOOT_SIZE_BYTES, ESP_RTC_USER_MEM + ESP_RTC_EBOOT_SIZE_WORDS,
+                 ESP_RTC_USER_MEM_SIZE_BYTES - ESP_RTC_EBOOT_SIZE_BYTES);
   enable_interrupts();
 }
-static void save_esp8266_flash() {
+/// Write the RTC memory to flash if it was modified, returns whether the flash was written.
+static bool save_esp8266_flash() {
   if (!esp8266_preferences_modified)
-    return;
+    return false;
 
   ESP_LOGVV(TAG, "Saving preferences to flash...");
   disable_interrupts();
@@ -109,17 +125,24 @@ static void save_esp8266_flash() {
   if (erase_res != SPI_FLASH_RESULT_OK) {
     enable_interrupts();
     ESP_LOGV(TAG, "Erase ESP8266 flash failed!");
-    return;
+    return false;
   }
 
-  auto write_res = spi_flash_write(get_esp8266_flash_address(), ESP_RTC_USER_MEM, ESP_RTC_USER_MEM_SIZE_BYTES);
+  // the eboot words are stored as zeros, spi_flash_write needs the source in RAM
+  static uint32_t eboot_zeros[ESP_RTC_EBOOT_SIZE_WORDS] = {0};
+  auto write_res = spi_flash_write(get_esp8266_flash_address(), eboot_zeros, ESP_RTC_EBOOT_SIZE_BYTES);
+  if (write_res == SPI_FLASH_RESULT_OK)
+    write_res = spi_flash_write(get_esp8266_flash_address() + ESP_RTC_EBOOT_SIZE_BYTES,
+                                ESP_RTC_USER_MEM + ESP_RTC_EBOOT_SIZE_WORDS,
+                                ESP_RTC_USER_MEM_SIZE_BYTES - ESP_RTC_EBOOT_SIZE_BYTES);
   enable_interrupts();
   if (write_res != SPI_FLASH_RESULT_OK) {
     ESP_LOGV(TAG, "Write ESP8266 flash failed!");
-    return;
+    return false;
   }
 
   esp8266_preferences_modified = false;
+  return true;
 }
 #endif
 
@@ -130,7 +153,15 @@ bool ESPPreferenceObject::save_internal_() {
   }
 
 #ifdef USE_ESP8266_PREFERENCES_FLASH
-  save_esp8266_flash();
+  // RTC memory is the cache for the flash sector, only the (slow) sector write is delayed
+  if (this->write_delay_ == 0 && !global_preferences.is_prevent_write()) {
+    if (save_esp8266_flash())
+      global_preferences.write_count_++;
+  } else {
+    global_preferences.schedule_sync_(*this);
+  }
+#else
+  global_preferences.write_count_++;
 #endif
   return true;
 }
@@ -151,6 +182,7 @@ void ESPPreferences::begin(const std::string &name) {
 #ifdef USE_ESP8266_PREFERENCES_FLASH
   load_esp8266_flash();
 #endif
+  add_safe_shutdown_hook([this](const char *cause) { this->sync(); });
 }
 
 ESPPreferenceObject ESPPreferences::make_preference(size_t length, uint32_t type) {
@@ -170,6 +202,12 @@ ESPPreferenceObject ESPPreferences::make_preference(size_t length, uint32_t type
     // Doesn't fit in data, return uninitialized preference obj.
     return ESPPreferenceObject();
   }
+#ifdef USE_ESP8266_PREFERENCES_FLASH
+  if (!in_normal) {
+    // the eboot words are not stored in flash, don't hand out preferences that would be lost on every reboot
+    return ESPPreferenceObject();
+  }
+#endif
 
   uint32_t rtc_offset;
   if (in_normal) {
@@ -179,15 +217,32 @@ ESPPreferenceObject ESPPreferences::make_preference(size_t length, uint32_t type
   }
 
   auto pref = ESPPreferenceObject(rtc_offset, length, type);
+  pref.set_write_delay(this->write_delay_);
   this->current_offset_ += length + 1;
   return pref;
 }
 void ESPPreferences::prevent_write(bool prevent) { this->prevent_write_ = prevent; }
 bool ESPPreferences::is_prevent_write() { return this->prevent_write_; }
+void ESPPreferences::sync() {
+  this->sync_pending_ = false;
+#ifdef USE_ESP8266_PREFERENCES_FLASH
+  // an OTA update has written the eboot command to RTC memory, keep the flash untouched until the reboot
+  if (this->is_prevent_write())
+    return;
+  if (save_esp8266_flash())
+    this->write_count_++;
+#endif
+}
 #endif
 
 #ifdef ARDUINO_ARCH_ESP32
 bool ESPPreferenceObject::save_internal_() {
+  if (this->write_delay_ == 0)
+    return this->write_nvs_();
+  global_preferences.schedule_sync_(*this);
+  return true;
+}
+bool ESPPreferenceObject::write_nvs_() {
   char key[32];
   sprintf(key, "%u", this->rtc_offset_);
   uint32_t len = (this->length_words_ + 1) * 4;
@@ -196,6 +251,7 @@ bool ESPPreferenceObject::save_internal_() {
     ESP_LOGV(TAG, "putBytes failed!");
     return false;
   }
+  global_preferences.write_count_++;
   return true;
 }
 bool ESPPreferenceObject::load_internal_() {
@@ -214,14 +270,48 @@ void ESPPreferences::begin(const std::string &name) {
   const std::string key = truncate_string(name, 15);
   ESP_LOGV(TAG, "Opening preferences with key '%s'", key.c_str());
   this->preferences_.begin(key.c_str());
+  add_safe_shutdown_hook([this](const char *cause) { this->sync(); });
 }
 
 ESPPreferenceObject ESPPreferences::make_preference(size_t length, uint32_t type) {
   auto pref = ESPPreferenceObject(this->current_offset_, length, type);
+  pref.set_write_delay(this->write_delay_);
   this->current_offset_++;
   return pref;
 }
+void ESPPreferences::sync() {
+  this->sync_pending_ = false;
+  // copies of a preference object share data_, so the pending copy always writes the newest value
+  for (auto &pref : this->pending_)
+    pref.write_nvs_();
+  this->pending_.clear();
+}
+#endif
+void ESPPreferences::set_write_delay(uint32_t write_delay) { this->write_delay_ = write_delay; }
+void ESPPreferences::schedule_sync_(const ESPPreferenceObject &pref) {
+#ifdef ARDUINO_ARCH_ESP32
+  bool found = false;
+  for (auto &pending : this->pending_) {
+    if (pending.rtc_offset_ == pref.rtc_offset_)
+      found = true;
+  }
+  if (!found)
+    this->pending_.push_back(pref);
 #endif
+  const uint32_t deadline = millis() + pref.write_delay_;
+  if (!this->sync_pending_ || int32_t(deadline - this->sync_deadline_) < 0)
+    this->sync_deadline_ = deadline;
+  this->sync_pending_ = true;
+}
+void ESPPreferences::loop() {
+  if (!this->sync_pending_ || int32_t(millis() - this->sync_deadline_) < 0)
+    return;
+  ESP_LOGVV(TAG, "Writing delayed preferences...");
+  this->sync();
+}
+uint32_t ESPPreferences::get_save_count() const { return this->save_count_; }
+uint32_t ESPPreferences::get_unchanged_count() const { return this->unchanged_count_; }
+uint32_t ESPPreferences::get_write_count() const { return this->write_count_; }
 uint32_t ESPPreferenceObject::calculate_crc_() const {
   uint32_t crc = this->type_;
   for (size_t i = 0; i < this->length_words_; i++) {
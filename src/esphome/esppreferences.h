@@ -2,6 +2,7 @@
 #define ESPHOME_ESPPREFERENCES_H
 
 #include <string>
+#include <vector>
 
 #ifdef ARDUINO_ARCH_ESP32
 #include <Preferences.h>
@@ -12,6 +13,8 @@
 
 ESPHOME_NAMESPACE_BEGIN
 
+class ESPPreferences;
+
 class ESPPreferenceObject {
  public:
   ESPPreferenceObject();
@@ -23,11 +26,26 @@ class ESPPreferenceObject {
 
   bool is_initialized() const;
 
+  /** Set for how long writes of this object may be delayed (in ms).
+   *
+   * All saves within that time are combined into a single write, which reduces flash wear if the
+   * value changes quickly (for example while turning a dimmer knob). Pending writes are flushed on a
+   * safe shutdown. 0 writes immediately. Defaults to the write delay of ESPPreferences.
+   */
+  void set_write_delay(uint32_t write_delay);
+
  protected:
+  friend ESPPreferences;
+
   bool save_();
   bool load_();
   bool save_internal_();
   bool load_internal_();
+  /// Called instead of save_() when the new value is the same as the stored one.
+  bool save_unchanged_();
+#ifdef ARDUINO_ARCH_ESP32
+  bool write_nvs_();
+#endif
 
   uint32_t calculate_crc_() const;
 
@@ -35,6 +53,9 @@ class ESPPreferenceObject {
   size_t length_words_;
   uint32_t type_;
   uint32_t *data_;
+  uint32_t write_delay_{0};
+  /// Whether data_ contains the stored value, only then unchanged values can be detected.
+  bool in_sync_{false};
 };
 
 class ESPPreferences {
@@ -44,6 +65,20 @@ class ESPPreferences {
   ESPPreferenceObject make_preference(size_t length, uint32_t type);
   template<typename T> ESPPreferenceObject make_preference(uint32_t type);
 
+  /// Set the write delay for preference objects created after this call, see ESPPreferenceObject::set_write_delay.
+  void set_write_delay(uint32_t write_delay);
+  /// Write all delayed preference writes now.
+  void sync();
+  /// Write delayed preference writes once their delay has passed, called by the application in each loop.
+  void loop();
+
+  /// Get the number of save() calls.
+  uint32_t get_save_count() const;
+  /// Get the number of save() calls that were skipped because the value didn't change.
+  uint32_t get_unchanged_count() const;
+  /// Get the number of actual writes to the storage, saves of multiple objects can be combined into one write.
+  uint32_t get_write_count() const;
+
 #ifdef ARDUINO_ARCH_ESP8266
   /** On the ESP8266, we can't override the first 128 bytes during OTA uploads
    * as the eboot parameters are stored there. Writing there during an OTA upload
@@ -59,9 +94,20 @@ class ESPPreferences {
  protected:
   friend ESPPreferenceObject;
 
+  /// Write the storage in at most write_delay ms, writes of other objects until then are combined.
+  void schedule_sync_(const ESPPreferenceObject &pref);
+
   uint32_t current_offset_;
+  uint32_t write_delay_{1000};
+  bool sync_pending_{false};
+  uint32_t sync_deadline_{0};
+  uint32_t save_count_{0};
+  uint32_t unchanged_count_{0};
+  uint32_t write_count_{0};
 #ifdef ARDUINO_ARCH_ESP32
   Preferences preferences_;
+  /// Objects with a pending write, each NVS key is written separately.
+  std::vector<ESPPreferenceObject> pending_;
 #endif
 #ifdef ARDUINO_ARCH_ESP8266
   bool prevent_write_{false};
@@ -77,6 +123,8 @@ template<typename T> ESPPreferenceObject ESPPreferences::make_preference(uint32_
 template<typename T> bool ESPPreferenceObject::save(T *src) {
   if (!this->is_initialized())
     return false;
+  if (this->in_sync_ && memcmp(this->data_, src, sizeof(T)) == 0)
+    return this->save_unchanged_();
   memset(this->data_, 0, this->length_words_ * 4);
   memcpy(this->data_, src, sizeof(T));
   return this->save_();
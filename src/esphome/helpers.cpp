@@ -84,6 +84,18 @@ float gamma_correct(float value, float gamma) {
 
   return powf(value, gamma);
 }
+uint16_t float_to_q16(float value) {
+  if (value <= 0.0f)
+    return 0;
+  if (value >= 1.0f)
+    return 65535;
+  return static_cast<uint16_t>(value * 65535.0f + 0.5f);
+}
+uint16_t HOT q16_mul(uint16_t a, uint16_t b) {
+  // x / 65535 rounded == (x + x / 65536) / 65536 for x = a * b + 32768
+  uint32_t x = uint32_t(a) * b + 32768UL;
+  return (x + (x >> 16)) >> 16;
+}
 std::string to_lowercase_underscore(std::string s) {
   std::transform(s.begin(), s.end(), s.begin(), ::tolower);
   std::replace(s.begin(), s.end(), ' ', '_');
@@ -158,6 +158,11 @@ uint8_t fast_random_8();
 /// Applies gamma correction with the provided gamma to value.
 float gamma_correct(float value, float gamma);
 
+/// Convert value (clamped to 0.0-1.0) to a 16-bit fixed point number, 65535 represents 1.0.
+uint16_t float_to_q16(float value);
+/// Multiply two 16-bit fixed point numbers (65535 represents 1.0) with rounding.
+uint16_t q16_mul(uint16_t a, uint16_t b);
+
 /// Create a string from a value and an accuracy in decimals.
 std::string value_accuracy_to_string(float value, int8_t accuracy_decimals);
 
@@ -5,9 +5,13 @@
 #include "esphome/i2c_component.h"
 #include "esphome/log.h"
 
+#include <algorithm>
+
 ESPHOME_NAMESPACE_BEGIN
 
 static const char *TAG = "i2c";
+/// The window in µs over which the bus utilization is measured.
+static const uint32_t I2C_UTILIZATION_WINDOW_US = 10000000;
 
 I2CComponent::I2CComponent(uint8_t sda_pin, uint8_t scl_pin, bool scan)
     : sda_pin_(sda_pin), scl_pin_(scl_pin), scan_(scan) {
@@ -26,10 +30,12 @@ void I2CComponent::set_sda_pin(uint8_t sda_pin) { this->sda_pin_ = sda_pin; }
 void I2CComponent::set_scl_pin(uint8_t scl_pin) { this->scl_pin_ = scl_pin; }
 void I2CComponent::set_scan(bool scan) { this->scan_ = scan; }
 void I2CComponent::set_frequency(uint32_t frequency) { this->frequency_ = frequency; }
+uint32_t I2CComponent::get_frequency() const { return this->frequency_; }
 
 void I2CComponent::setup() {
   this->wire_->begin(this->sda_pin_, this->scl_pin_);
   this->wire_->setClock(this->frequency_);
+  this->stats_start_ = micros();
 }
 void I2CComponent::dump_config() {
   ESP_LOGCONFIG(TAG, "I2C Bus:");
@@ -56,6 +62,147 @@ void I2CComponent::dump_config() {
       ESP_LOGI(TAG, "Found no i2c devices!");
     }
   }
+  for (auto &stats : this->device_stats_) {
+    uint32_t avg = stats.transactions == 0 ? 0 : stats.total_latency / stats.transactions;
+    ESP_LOGCONFIG(TAG, "  Device 0x%02X: %u transactions, %u failed, latency avg=%u ms max=%u ms", stats.address,
+                  stats.transactions, stats.failures, avg, stats.max_latency);
+  }
+}
+void I2CComponent::loop() {
+  this->update_bus_utilization_();
+  if (this->queue_.empty())
+    return;
+
+  const uint32_t now = millis();
+  // the vectors are members so that their capacity is kept between loops
+  std::vector<std::pair<i2c_callback_t, bool>> &completed = this->completed_;
+  std::vector<uint8_t> &busy_addresses = this->busy_addresses_;
+  busy_addresses.clear();
+
+  for (auto it = this->queue_.begin(); it != this->queue_.end();) {
+    I2CTransaction &transaction = *it;
+    bool done = false;
+    bool success = false;
+
+    if (transaction.timeout != 0 && now - transaction.queued_at > transaction.timeout) {
+      ESP_LOGW(TAG, "Transaction for address 0x%02X timed out", transaction.address);
+      done = true;
+    } else if (std::find(busy_addresses.begin(), busy_addresses.end(), transaction.address) !=
+               busy_addresses.end()) {
+      // an earlier transaction for this device is still in progress, keep order per device.
+    } else if (!transaction.written) {
+      busy_addresses.push_back(transaction.address);
+      if (!this->transaction_write_(transaction)) {
+        done = true;
+      } else if (transaction.read_len == 0) {
+        done = success = true;
+      } else {
+        transaction.written = true;
+        transaction.written_at = now;
+      }
+    } else {
+      busy_addresses.push_back(transaction.address);
+      if (now - transaction.written_at >= transaction.conversion) {
+        const uint32_t start = micros();
+        success = this->raw_receive(transaction.address, transaction.read_data, transaction.read_len);
+        this->busy_us_ += micros() - start;
+        done = true;
+      }
+    }
+
+    if (!done) {
+      ++it;
+      continue;
+    }
+    this->record_transaction_(transaction, success, now);
+    if (transaction.callback)
+      completed.emplace_back(std::move(transaction.callback), success);
+    it = this->queue_.erase(it);
+  }
+
+  // Call callbacks after processing the queue, they may queue new transactions.
+  for (auto &pair : completed)
+    pair.first(pair.second);
+  completed.clear();
+}
+bool I2CComponent::transaction_write_(I2CTransaction &transaction) {
+  const uint32_t start = micros();
+  this->raw_begin_transmission(transaction.address);
+  this->raw_write(transaction.address, &transaction.a_register, 1);
+  this->raw_write(transaction.address, transaction.write_data.data(), transaction.write_data.size());
+  bool ret = this->raw_end_transmission(transaction.address);
+  this->busy_us_ += micros() - start;
+  return ret;
+}
+void I2CComponent::record_transaction_(const I2CTransaction &transaction, bool success, uint32_t now) {
+  I2CDeviceStats *stats = nullptr;
+  for (auto &s : this->device_stats_) {
+    if (s.address == transaction.address) {
+      stats = &s;
+      break;
+    }
+  }
+  if (stats == nullptr) {
+    this->device_stats_.push_back(I2CDeviceStats{
+        .address = transaction.address,
+        .transactions = 0,
+        .failures = 0,
+        .total_latency = 0,
+        .max_latency = 0,
+    });
+    stats = &this->device_stats_.back();
+  }
+
+  const uint32_t latency = now - transaction.queued_at;
+  stats->transactions++;
+  if (!success)
+    stats->failures++;
+  stats->total_latency += latency;
+  stats->max_latency = std::max(stats->max_latency, latency);
+}
+void I2CComponent::read_bytes_async(uint8_t address, uint8_t a_register, uint8_t *data, uint8_t len,
+                                    uint32_t conversion, i2c_callback_t &&callback, uint32_t timeout) {
+  this->queue_.push_back(I2CTransaction{
+      .address = address,
+      .a_register = a_register,
+      .write_data = {},
+      .read_data = data,
+      .read_len = len,
+      .conversion = conversion,
+      .timeout = timeout,
+      .callback = std::move(callback),
+      .queued_at = millis(),
+      .written_at = 0,
+      .written = false,
+  });
+}
+void I2CComponent::write_bytes_async(uint8_t address, uint8_t a_register, const uint8_t *data, uint8_t len,
+                                     i2c_callback_t &&callback, uint32_t timeout) {
+  this->queue_.push_back(I2CTransaction{
+      .address = address,
+      .a_register = a_register,
+      .write_data = std::vector<uint8_t>(data, data + len),
+      .read_data = nullptr,
+      .read_len = 0,
+      .conversion = 0,
+      .timeout = timeout,
+      .callback = std::move(callback),
+      .queued_at = millis(),
+      .written_at = 0,
+      .written = false,
+  });
+}
+float I2CComponent::get_bus_utilization() const { return this->bus_utilization_; }
+void I2CComponent::update_bus_utilization_() {
+  const uint32_t now = micros();
+  const uint32_t elapsed = now - this->stats_start_;
+  if (elapsed < I2C_UTILIZATION_WINDOW_US)
+    return;
+  this->bus_utilization_ = this->busy_us_ / float(elapsed);
+  this->busy_us_ = 0;
+  this->stats_start_ = now;
+  if (this->bus_utilization_ != 0.0f)
+    ESP_LOGV(TAG, "Bus Utilization: %.1f%%", this->bus_utilization_ * 100.0f);
 }
 float I2CComponent::get_setup_priority() const { return setup_priority::PRE_HARDWARE; }
 
@@ -203,6 +350,14 @@ bool I2CDevice::write_bytes_16(uint8_t a_register, const uint16_t *data, uint8_t
 bool I2CDevice::write_byte_16(uint8_t a_register, uint16_t data) {  // NOLINT
   return this->parent_->write_byte_16(this->address_, a_register, data);
 }
+void I2CDevice::read_bytes_async(uint8_t a_register, uint8_t *data, uint8_t len, uint32_t conversion,  // NOLINT
+                                 i2c_callback_t &&callback, uint32_t timeout) {
+  this->parent_->read_bytes_async(this->address_, a_register, data, len, conversion, std::move(callback), timeout);
+}
+void I2CDevice::write_bytes_async(uint8_t a_register, const uint8_t *data, uint8_t len,  // NOLINT
+                                  i2c_callback_t &&callback, uint32_t timeout) {
+  this->parent_->write_bytes_async(this->address_, a_register, data, len, std::move(callback), timeout);
+}
 void I2CDevice::set_parent(I2CComponent *parent) { this->parent_ = parent; }
 
 #ifdef ARDUINO_ARCH_ESP32
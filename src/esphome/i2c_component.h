@@ -7,11 +7,40 @@
 
 #include "esphome/component.h"
 #include <Wire.h>
+#include <functional>
+#include <vector>
 
 ESPHOME_NAMESPACE_BEGIN
 
 #define LOG_I2C_DEVICE(this) ESP_LOGCONFIG(TAG, "  Address: 0x%02X", this->address_);
 
+/// Callback for asynchronous i2c transactions, the parameter denotes whether the transaction was successful.
+using i2c_callback_t = std::function<void(bool)>;
+
+/// Internal struct for queued asynchronous i2c transactions.
+struct I2CTransaction {
+  uint8_t address;
+  uint8_t a_register;
+  std::vector<uint8_t> write_data;  ///< Data written after the register byte.
+  uint8_t *read_data;               ///< Where to store read data, must stay valid until the callback is called.
+  uint8_t read_len;                 ///< 0 for write-only transactions.
+  uint32_t conversion;              ///< Time in ms between the write and the read phase.
+  uint32_t timeout;                 ///< Maximum time in ms from queueing to completion, 0 means no deadline.
+  i2c_callback_t callback;
+  uint32_t queued_at;
+  uint32_t written_at;
+  bool written;
+};
+
+/// Internal struct for per-device statistics of asynchronous transactions.
+struct I2CDeviceStats {
+  uint8_t address;
+  uint32_t transactions;
+  uint32_t failures;
+  uint32_t total_latency;  ///< Sum of queue-to-completion times in ms.
+  uint32_t max_latency;    ///< Maximum queue-to-completion time in ms.
+};
+
 /** The I2CComponent is the base of ESPHome's i2c communication.
  *
  * It handles setting up the bus (with pins, clock frequency) and provides nice helper functions to
@@ -36,6 +65,7 @@ class I2CComponent : public Component {
   void set_scl_pin(uint8_t scl_pin);
   /// Set the i2c clock frequency in Hz for this bus, defaults to 1000 Hz.
   void set_frequency(uint32_t frequency);
+  uint32_t get_frequency() const;
   /// Set if a scan of the entire i2c address range should be done on startup.
   void set_scan(bool scan);
 
@@ -94,6 +124,40 @@ class I2CComponent : public Component {
   /// Write a single 16-bit word of data into the specified register of address. Return true if successful.
   bool write_byte_16(uint8_t address, uint8_t a_register, uint16_t data);
 
+  /** Queue an asynchronous write-then-read transaction.
+   *
+   * The register value is written to the bus, then after the conversion time has passed (without blocking the
+   * main loop) len bytes are read into data and the callback is called. Transactions for the same address are
+   * executed in order, transactions for different addresses can wait for their conversion at the same time.
+   *
+   * @param address The address to send the request to.
+   * @param a_register The register number to write to the bus before reading.
+   * @param data An array to store len amount of 8-bit bytes into, must stay valid until the callback is called.
+   * @param len The amount of bytes to request and write into data.
+   * @param conversion The time in ms between writing the register value and reading out the value.
+   * @param callback The callback that is called with whether the transaction was successful.
+   * @param timeout The maximum time in ms from queueing to completion, 0 for no deadline.
+   */
+  void read_bytes_async(uint8_t address, uint8_t a_register, uint8_t *data, uint8_t len, uint32_t conversion,
+                        i2c_callback_t &&callback, uint32_t timeout = 0);
+
+  /** Queue an asynchronous write of len bytes to the specified register of address.
+   *
+   * The data is copied, so it does not need to stay valid after this call.
+   *
+   * @param address The address to use for the transmission.
+   * @param a_register The register to write the values to.
+   * @param data An array from which len bytes of data will be written to the bus.
+   * @param len The amount of bytes to write to the bus.
+   * @param callback The callback that is called with whether the transaction was successful, may be empty.
+   * @param timeout The maximum time in ms from queueing to completion, 0 for no deadline.
+   */
+  void write_bytes_async(uint8_t address, uint8_t a_register, const uint8_t *data, uint8_t len,
+                         i2c_callback_t &&callback, uint32_t timeout = 0);
+
+  /// Get the fraction of time the bus was busy with asynchronous transactions in the last 10 seconds (0.0 to 1.0).
+  float get_bus_utilization() const;
+
   // ========== INTERNAL METHODS ==========
   // (In most use cases you won't need these)
   /// Begin a write transmission to an address.
@@ -125,6 +189,8 @@ class I2CComponent : public Component {
   /// Setup the i2c. bus
   void setup() override;
   void dump_config() override;
+  /// Process the queue of asynchronous transactions.
+  void loop() override;
   /// Set a very high setup priority to make sure it's loaded before all other hardware.
   float get_setup_priority() const override;
 
@@ -132,8 +198,24 @@ class I2CComponent : public Component {
   TwoWire *wire_;
   uint8_t sda_pin_;
   uint8_t scl_pin_;
+  /// Execute the write phase of a transaction, returns false on failure.
+  bool transaction_write_(I2CTransaction &transaction);
+  /// Record the completion of an asynchronous transaction in the per-device statistics.
+  void record_transaction_(const I2CTransaction &transaction, bool success, uint32_t now);
+  /// Close the current bus utilization window once it is over.
+  void update_bus_utilization_();
+
   bool scan_;
   uint32_t frequency_{50000};
+  std::vector<I2CTransaction> queue_;
+  /// Transactions completed in the current loop() with their result, their callbacks run after the queue pass.
+  std::vector<std::pair<i2c_callback_t, bool>> completed_;
+  /// Addresses with a transaction in progress in the current loop().
+  std::vector<uint8_t> busy_addresses_;
+  std::vector<I2CDeviceStats> device_stats_;
+  uint32_t busy_us_{0};
+  uint32_t stats_start_{0};
+  float bus_utilization_{0.0f};
 };
 
 #ifdef ARDUINO_ARCH_ESP32
@@ -210,6 +292,14 @@ class I2CDevice {
   /// Write a single 16-bit word of data into the specified register. Return true if successful.
   bool write_byte_16(uint8_t a_register, uint16_t data);  // NOLINT
 
+  /// Queue an asynchronous write-then-read transaction, see I2CComponent::read_bytes_async.
+  void read_bytes_async(uint8_t a_register, uint8_t *data, uint8_t len, uint32_t conversion,  // NOLINT
+                        i2c_callback_t &&callback, uint32_t timeout = 0);
+
+  /// Queue an asynchronous write, see I2CComponent::write_bytes_async.
+  void write_bytes_async(uint8_t a_register, const uint8_t *data, uint8_t len,  // NOLINT
+                         i2c_callback_t &&callback, uint32_t timeout = 0);
+
   uint8_t address_;
   I2CComponent *parent_;
 };
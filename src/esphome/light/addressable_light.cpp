@@ -5,6 +5,9 @@
 #include "esphome/light/addressable_light.h"
 #include "esphome/log.h"
 #include "esphome/helpers.h"
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
 
 ESPHOME_NAMESPACE_BEGIN
 
@@ -93,6 +96,7 @@ ESPColorCorrection::ESPColorCorrection() : max_brightness_(255, 255, 255, 255) {
 void ESPColorCorrection::set_local_brightness(uint8_t local_brightness) { this->local_brightness_ = local_brightness; }
 
 void ESPColorCorrection::set_max_brightness(const ESPColor &max_brightness) { this->max_brightness_ = max_brightness; }
+const ESPColor &ESPColorCorrection::get_max_brightness() const { return this->max_brightness_; }
 
 void ESPColorCorrection::calculate_gamma_table(float gamma) {
   for (uint16_t i = 0; i < 256; i++) {
@@ -119,21 +123,41 @@ bool AddressableLight::is_effect_active() const { return this->effect_active_; }
 void AddressableLight::set_effect_active(bool effect_active) { this->effect_active_ = effect_active; }
 void AddressableLight::write_state(LightState *state) {
   auto val = state->current_values;
+#ifdef USE_LIGHT_FIXED_POINT
+  // x / 257 converts 0-65535 to 0-255, the same as roundf(x / 65535.0f * 255.0f)
+  uint16_t brightness_q16;
+  val.as_brightness_q16(&brightness_q16);
+  auto max_brightness = static_cast<uint8_t>((brightness_q16 + 128) / 257);
+#else
   auto max_brightness = static_cast<uint8_t>(roundf(val.get_brightness() * val.get_state() * 255.0f));
+#endif
   this->correction_.set_local_brightness(max_brightness);
+  if (this->dithering_) {
+#ifdef USE_LIGHT_FIXED_POINT
+    this->dither_brightness_ = this->gamma_correct16_(brightness_q16);
+#else
+    const float brightness = gamma_correct(val.get_brightness() * val.get_state(), this->gamma_);
+    this->dither_brightness_ = static_cast<uint16_t>(roundf(brightness * 65535.0f));
+#endif
+  }
 
   if (this->is_effect_active())
     return;
 
   // don't use LightState helper, gamma correction+brightness is handled by ESPColorView
+#ifdef USE_LIGHT_FIXED_POINT
+  ESPColor color = ESPColor((val.get_red_q16() + 128) / 257, (val.get_green_q16() + 128) / 257,
+                            (val.get_blue_q16() + 128) / 257,
+                            // white is not affected by brightness; so manually scale by state
+                            (q16_mul(val.get_white_q16(), val.get_state_q16()) + 128) / 257);
+#else
   ESPColor color = ESPColor(uint8_t(roundf(val.get_red() * 255.0f)), uint8_t(roundf(val.get_green() * 255.0f)),
                             uint8_t(roundf(val.get_blue() * 255.0f)),
                             // white is not affected by brightness; so manually scale by state
                             uint8_t(roundf(val.get_white() * val.get_state() * 255.0f)));
+#endif
 
-  for (int i = 0; i < this->size(); i++) {
-    (*this)[i] = color;
-  }
+  this->fill(color);
 
   this->schedule_show();
 }
@@ -143,39 +167,344 @@ void AddressableLight::set_correction(float red, float green, float blue, float
 }
 void AddressableLight::setup_state(LightState *state) {
   this->correction_.calculate_gamma_table(state->get_gamma_correct());
+  this->gamma_ = state->get_gamma_correct();
+  if (this->dithering_) {
+    if (this->gamma_table16_ == nullptr)
+      this->gamma_table16_ = new uint16_t[256];
+    for (uint16_t i = 0; i < 256; i++)
+      this->gamma_table16_[i] = static_cast<uint16_t>(roundf(65535.0f * gamma_correct(i / 255.0f, this->gamma_)));
+  }
+}
+#ifdef USE_LIGHT_FIXED_POINT
+uint16_t AddressableLight::gamma_correct16_(uint16_t value) const {
+  if (this->gamma_table16_ == nullptr)
+    return value;
+  // entry i of the table is for i * 257, interpolate linearly in between
+  const uint16_t index = value / 257;
+  const uint16_t frac = value % 257;
+  uint32_t corrected = this->gamma_table16_[index];
+  if (frac != 0) {
+    const uint32_t next = this->gamma_table16_[index + 1];
+    corrected += ((next - corrected) * frac + 128) / 257;
+  }
+  return corrected;
 }
+#endif
 void AddressableLight::schedule_show() { this->next_show_ = true; }
-bool AddressableLight::should_show_() const { return this->effect_active_ || this->next_show_; }
-void AddressableLight::mark_shown_() { this->next_show_ = false; }
+bool AddressableLight::should_show_() {
+  // dithering needs a new frame every time
+  if (this->dithering_)
+    return true;
+  const bool refresh =
+      this->min_refresh_interval_ != 0 && millis() - this->last_show_ >= this->min_refresh_interval_;
+  // only hash the pixels if a frame was rendered since the last show (schedule_show() was called)
+  if (!this->next_show_ && !refresh)
+    return false;
+
+  ESPRawPixelBuffer buf{};
+  if (!this->get_raw_buffer_(&buf))
+    return true;
+
+  this->pending_hash_ = this->hash_pixels_(buf);
+  if (refresh || this->pending_hash_ != this->shown_hash_ || this->frames_shown_ == 0)
+    return true;
+
+  // the frame is the same as the last one, skip sending the exact same data again
+  this->next_show_ = false;
+  this->frames_skipped_++;
+  return false;
+}
+void AddressableLight::mark_shown_() {
+  this->next_show_ = false;
+  this->shown_hash_ = this->pending_hash_;
+  this->last_show_ = millis();
+  this->frames_shown_++;
+}
+uint32_t HOT AddressableLight::hash_pixels_(const ESPRawPixelBuffer &buffer) const {
+  // FNV-1, same as fnv1_hash()
+  uint32_t hash = 2166136261UL;
+  const uint8_t *data = buffer.data;
+  const uint8_t *end = data + buffer.stride * size_t(this->size());
+  for (; data != end; data++) {
+    hash *= 16777619UL;
+    hash ^= *data;
+  }
+  return hash;
+}
+void AddressableLight::set_min_refresh_interval(uint32_t min_refresh_interval) {
+  this->min_refresh_interval_ = min_refresh_interval;
+}
+uint32_t AddressableLight::get_frames_shown() const { return this->frames_shown_; }
+uint32_t AddressableLight::get_frames_skipped() const { return this->frames_skipped_; }
+void AddressableLight::set_dithering(bool dithering) {
+  if (dithering && !this->dithering_)
+    this->dither_high_freq_.start();
+  if (!dithering && this->dithering_)
+    this->dither_high_freq_.stop();
+  this->dithering_ = dithering;
+}
+bool AddressableLight::is_dithering() const { return this->dithering_; }
+const ESPColorCorrection &AddressableLight::get_write_correction_() const {
+  if (!this->dithering_)
+    return this->correction_;
+  static ESPColorCorrection *identity = nullptr;
+  if (identity == nullptr) {
+    identity = new ESPColorCorrection();
+    identity->calculate_gamma_table(0.0f);
+  }
+  return *identity;
+}
+void HOT AddressableLight::render_dithered_(uint8_t *dst) {
+  ESPRawPixelBuffer buf{};
+  if (this->gamma_table16_ == nullptr || !this->get_raw_buffer_(&buf))
+    return;
+
+  // (value * max_brightness * brightness) ^ gamma = value ^ gamma * max_brightness ^ gamma * brightness ^ gamma
+  const ESPColor &max_brightness = this->correction_.get_max_brightness();
+  uint32_t factor[4];
+  for (uint8_t c = 0; c < 3; c++)
+    factor[c] = (uint32_t(this->gamma_table16_[max_brightness.raw[c]]) * this->dither_brightness_) >> 16;
+  // white is not affected by brightness
+  factor[3] = this->gamma_table16_[max_brightness.white];
+
+  const int32_t size = this->size();
+  if (this->dither_error_ == nullptr) {
+    this->dither_error_ = new uint8_t[size * buf.stride];
+    // start each channel at a different phase so that neighbors don't change at the same time
+    for (int32_t i = 0; i < size * buf.stride; i++)
+      this->dither_error_[i] = i * 97;
+  }
+
+  // temporal error diffusion: the low byte of each channel is carried over to the next frame, so the average
+  // over 256 frames has the full 16-bit precision
+  uint8_t *error = this->dither_error_;
+  for (int32_t i = 0; i < size; i++) {
+    const uint8_t *src_pixel = buf.data + buf.stride * i;
+    uint8_t *dst_pixel = dst + buf.stride * i;
+    for (uint8_t c = 0; c < buf.stride; c++, error++) {
+      const uint8_t off = buf.offsets[c];
+      const uint32_t value = ((this->gamma_table16_[src_pixel[off]] * factor[c]) >> 16) + *error;
+      if (value > 0xFFFF) {
+        dst_pixel[off] = 255;
+        *error = 0;
+      } else {
+        dst_pixel[off] = value >> 8;
+        *error = value & 0xFF;
+      }
+    }
+  }
+}
+bool AddressableLight::get_raw_buffer_(ESPRawPixelBuffer *buffer) { return false; }
+bool AddressableLight::clamp_range_(int32_t *start, int32_t *end) const {
+  *start = std::max(*start, int32_t(0));
+  *end = std::min(*end, this->size());
+  return *start < *end;
+}
+
+static inline ESPColor raw_get_pixel(const ESPRawPixelBuffer &buf, int32_t index) ALWAYS_INLINE;
+static inline void raw_set_pixel(const ESPRawPixelBuffer &buf, int32_t index, const ESPColor &color) ALWAYS_INLINE;
+
+static ESPColor raw_get_pixel(const ESPRawPixelBuffer &buf, int32_t index) {
+  const uint8_t *base = buf.data + buf.stride * index;
+  return ESPColor(base[buf.offsets[0]], base[buf.offsets[1]], base[buf.offsets[2]],
+                  buf.stride == 4 ? base[buf.offsets[3]] : 0);
+}
+static void raw_set_pixel(const ESPRawPixelBuffer &buf, int32_t index, const ESPColor &color) {
+  uint8_t *base = buf.data + buf.stride * index;
+  base[buf.offsets[0]] = color.r;
+  base[buf.offsets[1]] = color.g;
+  base[buf.offsets[2]] = color.b;
+  if (buf.stride == 4)
+    base[buf.offsets[3]] = color.w;
+}
+
+void AddressableLight::fill(int32_t start, int32_t end, const ESPColor &color) {
+  this->fill_(start, end, color, this->get_write_correction_());
+}
+void AddressableLight::fill(const ESPColor &color) { this->fill(0, this->size(), color); }
+void AddressableLight::fade_to_black(int32_t start, int32_t end, uint8_t amount) {
+  this->fade_to_black_(start, end, amount, this->get_write_correction_());
+}
+void AddressableLight::blend(int32_t start, int32_t end, const ESPColor &color, uint8_t alpha) {
+  this->blend_(start, end, color, alpha, this->get_write_correction_());
+}
+void HOT AddressableLight::shift(int32_t start, int32_t end, int32_t amount) {
+  if (amount == 0 || !this->clamp_range_(&start, &end))
+    return;
+  const int32_t len = end - start;
+  if (amount >= len || -amount >= len)
+    return;
+  ESPRawPixelBuffer buf{};
+  if (!this->get_raw_buffer_(&buf)) {
+    if (amount > 0) {
+      for (int32_t i = end - 1; i >= start + amount; i--)
+        (*this)[i] = (*this)[i - amount].get();
+    } else {
+      for (int32_t i = start; i < end + amount; i++)
+        (*this)[i] = (*this)[i - amount].get();
+    }
+    return;
+  }
+
+  // no color correction necessary, pixels are moved as they are
+  uint8_t *base = buf.data + buf.stride * start;
+  const size_t bytes = buf.stride * size_t(len - std::abs(amount));
+  if (amount > 0) {
+    memmove(base + buf.stride * amount, base, bytes);
+  } else {
+    memmove(base, base - buf.stride * amount, bytes);
+  }
+}
+void AddressableLight::copy_from(int32_t start, const ESPColor *buffer, int32_t len) {
+  this->copy_from_(start, buffer, len, this->get_write_correction_());
+}
+void HOT AddressableLight::fill_(int32_t start, int32_t end, const ESPColor &color,
+                                 const ESPColorCorrection &correction) {
+  if (!this->clamp_range_(&start, &end))
+    return;
+  ESPRawPixelBuffer buf{};
+  if (!this->get_raw_buffer_(&buf)) {
+    for (int32_t i = start; i < end; i++) {
+      ESPColorView view = (*this)[i];
+      view.raw_set_color_correction(&correction);
+      view = color;
+    }
+    return;
+  }
+
+  raw_set_pixel(buf, start, correction.color_correct(color));
+  // repeatedly copy the already filled part, doubling it each time
+  uint8_t *dst = buf.data + buf.stride * start;
+  const size_t total = buf.stride * size_t(end - start);
+  size_t filled = buf.stride;
+  while (filled < total) {
+    const size_t len = std::min(filled, total - filled);
+    memcpy(dst + filled, dst, len);
+    filled += len;
+  }
+}
+void HOT AddressableLight::fade_to_black_(int32_t start, int32_t end, uint8_t amount,
+                                          const ESPColorCorrection &correction) {
+  if (amount == 0 || !this->clamp_range_(&start, &end))
+    return;
+  const uint8_t scale = 255 - amount;
+  ESPRawPixelBuffer buf{};
+  if (!this->get_raw_buffer_(&buf)) {
+    for (int32_t i = start; i < end; i++) {
+      ESPColorView view = (*this)[i];
+      view.raw_set_color_correction(&correction);
+      view = view.get() * scale;
+    }
+    return;
+  }
+
+  // scale the uncorrected values like operator[] does, so that the fade curve doesn't depend on the backend
+  for (int32_t i = start; i < end; i++) {
+    const ESPColor current = correction.color_uncorrect(raw_get_pixel(buf, i));
+    raw_set_pixel(buf, i, correction.color_correct(current * scale));
+  }
+}
+void HOT AddressableLight::blend_(int32_t start, int32_t end, const ESPColor &color, uint8_t alpha,
+                                  const ESPColorCorrection &correction) {
+  if (alpha == 0 || !this->clamp_range_(&start, &end))
+    return;
+  const uint8_t keep = 255 - alpha;
+  const ESPColor add = color * alpha;
+  ESPRawPixelBuffer buf{};
+  if (!this->get_raw_buffer_(&buf)) {
+    for (int32_t i = start; i < end; i++) {
+      ESPColorView view = (*this)[i];
+      view.raw_set_color_correction(&correction);
+      view = view.get() * keep + add;
+    }
+    return;
+  }
+
+  for (int32_t i = start; i < end; i++) {
+    const ESPColor current = correction.color_uncorrect(raw_get_pixel(buf, i));
+    raw_set_pixel(buf, i, correction.color_correct(current * keep + add));
+  }
+}
+void HOT AddressableLight::copy_from_(int32_t start, const ESPColor *buffer, int32_t len,
+                                      const ESPColorCorrection &correction) {
+  int32_t end = start + len;
+  const int32_t offset = start;
+  if (!this->clamp_range_(&start, &end))
+    return;
+  buffer += start - offset;
+  ESPRawPixelBuffer buf{};
+  if (!this->get_raw_buffer_(&buf)) {
+    for (int32_t i = start; i < end; i++) {
+      ESPColorView view = (*this)[i];
+      view.raw_set_color_correction(&correction);
+      view = *buffer++;
+    }
+    return;
+  }
+
+  for (int32_t i = start; i < end; i++)
+    raw_set_pixel(buf, i, correction.color_correct(*buffer++));
+}
 
 int32_t PartitionLightOutput::size() const {
   auto &last_seg = this->segments_[this->segments_.size() - 1];
   return last_seg.get_dst_offset() + last_seg.get_size();
 }
 ESPColorView PartitionLightOutput::operator[](int32_t index) const {
-  uint32_t lo = 0;
-  uint32_t hi = this->segments_.size() - 1;
-  while (lo < hi) {
-    uint32_t mid = (lo + hi) / 2;
-    int32_t begin = this->segments_[mid].get_dst_offset();
-    int32_t end = begin + this->segments_[mid].get_size();
-    if (index < begin) {
-      hi = mid - 1;
-    } else if (index >= end) {
-      lo = mid + 1;
-    } else {
-      lo = hi = mid;
-    }
-  }
-  auto &seg = this->segments_[lo];
-  // offset within the segment
-  int32_t seg_off = index - seg.get_dst_offset();
-  // offset within the src
-  int32_t src_off = seg.get_src_offset() + seg_off;
-  auto view = (*seg.get_src())[src_off];
+  auto &seg = this->find_segment_(index);
+  auto view = (*seg.get_src())[seg.get_src_index(index)];
   view.raw_set_color_correction(&this->correction_);
   return view;
 }
+const AddressableSegment &PartitionLightOutput::find_segment_(int32_t index) const {
+  const AddressableSegment &last = this->segments_[this->last_segment_];
+  if (index >= last.get_dst_offset() && index < last.get_dst_offset() + last.get_size())
+    return last;
+
+  auto it = std::upper_bound(this->segments_.begin(), this->segments_.end(), index,
+                             [](int32_t i, const AddressableSegment &seg) { return i < seg.get_dst_offset(); });
+  this->last_segment_ = it == this->segments_.begin() ? 0 : (it - this->segments_.begin()) - 1;
+  return this->segments_[this->last_segment_];
+}
+void PartitionLightOutput::fill(int32_t start, int32_t end, const ESPColor &color) {
+  int32_t src_start, src_end;
+  for (auto &seg : this->segments_) {
+    if (seg.get_src_range(start, end, &src_start, &src_end))
+      seg.get_src()->fill_(src_start, src_end, color, this->correction_);
+  }
+}
+void PartitionLightOutput::fade_to_black(int32_t start, int32_t end, uint8_t amount) {
+  int32_t src_start, src_end;
+  for (auto &seg : this->segments_) {
+    if (seg.get_src_range(start, end, &src_start, &src_end))
+      seg.get_src()->fade_to_black_(src_start, src_end, amount, this->correction_);
+  }
+}
+void PartitionLightOutput::blend(int32_t start, int32_t end, const ESPColor &color, uint8_t alpha) {
+  int32_t src_start, src_end;
+  for (auto &seg : this->segments_) {
+    if (seg.get_src_range(start, end, &src_start, &src_end))
+      seg.get_src()->blend_(src_start, src_end, color, alpha, this->correction_);
+  }
+}
+void PartitionLightOutput::copy_from(int32_t start, const ESPColor *buffer, int32_t len) {
+  const int32_t end = start + len;
+  int32_t src_start, src_end;
+  for (auto &seg : this->segments_) {
+    if (!seg.get_src_range(start, end, &src_start, &src_end))
+      continue;
+    const ESPColor *seg_buffer = buffer + (std::max(start, seg.get_dst_offset()) - start);
+    if (!seg.is_reversed()) {
+      seg.get_src()->copy_from_(src_start, seg_buffer, src_end - src_start, this->correction_);
+      continue;
+    }
+    for (int32_t i = src_end - 1; i >= src_start; i--) {
+      ESPColorView view = (*seg.get_src())[i];
+      view.raw_set_color_correction(&this->correction_);
+      view = *seg_buffer++;
+    }
+  }
+}
 void PartitionLightOutput::clear_effect_data() {
   for (auto &seg : this->segments_) {
     seg.get_src()->clear_effect_data();
@@ -191,20 +520,38 @@ PartitionLightOutput::PartitionLightOutput(const std::vector<AddressableSegment>
 }
 void PartitionLightOutput::loop() {
   if (this->should_show_()) {
-    for (auto seg : this->segments_) {
+    for (auto &seg : this->segments_) {
       seg.get_src()->schedule_show();
     }
     this->mark_shown_();
   }
 }
 
-AddressableSegment::AddressableSegment(LightState *src, int32_t src_offset, int32_t size)
-    : src_(static_cast<AddressableLight *>(src->get_output())), src_offset_(src_offset), size_(size) {}
+AddressableSegment::AddressableSegment(LightState *src, int32_t src_offset, int32_t size, bool reversed)
+    : src_(static_cast<AddressableLight *>(src->get_output())),
+      src_offset_(src_offset),
+      size_(size),
+      reversed_(reversed) {}
 AddressableLight *AddressableSegment::get_src() const { return this->src_; }
 int32_t AddressableSegment::get_src_offset() const { return this->src_offset_; }
 int32_t AddressableSegment::get_size() const { return this->size_; }
 int32_t AddressableSegment::get_dst_offset() const { return this->dst_offset_; }
 void AddressableSegment::set_dst_offset(int32_t dst_offset) { this->dst_offset_ = dst_offset; }
+bool AddressableSegment::is_reversed() const { return this->reversed_; }
+bool AddressableSegment::get_src_range(int32_t start, int32_t end, int32_t *src_start, int32_t *src_end) const {
+  start = std::max(start, this->dst_offset_);
+  end = std::min(end, this->dst_offset_ + this->size_);
+  if (start >= end)
+    return false;
+  if (this->reversed_) {
+    *src_start = this->get_src_index(end - 1);
+    *src_end = this->get_src_index(start) + 1;
+  } else {
+    *src_start = this->get_src_index(start);
+    *src_end = this->get_src_index(end - 1) + 1;
+  }
+  return true;
+}
 
 }  // namespace light
 
@@ -99,6 +99,7 @@ class ESPColorCorrection {
   inline uint8_t color_uncorrect_green(uint8_t green) const ALWAYS_INLINE;
   inline uint8_t color_uncorrect_blue(uint8_t blue) const ALWAYS_INLINE;
   inline uint8_t color_uncorrect_white(uint8_t white) const ALWAYS_INLINE;
+  const ESPColor &get_max_brightness() const;
 
  protected:
   uint8_t gamma_table_[256];
@@ -129,6 +130,11 @@ class ESPColorView {
   inline uint8_t get_white() const ALWAYS_INLINE;
   inline uint8_t get_effect_data() const ALWAYS_INLINE;
   inline void raw_set_color_correction(const ESPColorCorrection *color_correction) ALWAYS_INLINE;
+  /** Copy the stored (color corrected) bytes and the effect data of another pixel of the same light.
+   *
+   * Unlike view = other.get(), this doesn't convert the color back and forth, which loses precision.
+   */
+  inline void raw_copy_from(const ESPColorView &other) const ALWAYS_INLINE;
 
  protected:
   uint8_t *const red_;
@@ -139,6 +145,15 @@ class ESPColorView {
   const ESPColorCorrection *color_correction_;
 };
 
+/// A contiguous buffer of pixels as stored by a backend (already color corrected).
+struct ESPRawPixelBuffer {
+  uint8_t *data;
+  /// Number of bytes per pixel, 3 for RGB and 4 for RGBW.
+  uint8_t stride;
+  /// Offsets of the red, green, blue and white channel within one pixel.
+  const uint8_t *offsets;
+};
+
 class AddressableLight : public LightOutput {
  public:
   AddressableLight();
@@ -151,33 +166,136 @@ class AddressableLight : public LightOutput {
   void set_correction(float red, float green, float blue, float white = 1.0f);
   void setup_state(LightState *state) override;
   void schedule_show();
+  /** Set the interval in ms after which the pixels are sent again even if they didn't change.
+   *
+   * By default pixels are only sent to the strip when they were changed, some strips however
+   * need to be refreshed regularly. Set to 0 to disable (the default).
+   */
+  void set_min_refresh_interval(uint32_t min_refresh_interval);
+  /// Get the number of frames that were sent to the strip.
+  uint32_t get_frames_shown() const;
+  /// Get the number of rendered frames that were not sent to the strip because no pixel changed.
+  uint32_t get_frames_skipped() const;
+  /** Enable temporal dithering, must be called before setup. Only FastLED, NeoPixelBus and ESP32 RMT lights support
+   * this.
+   *
+   * Pixels are then stored without color correction in an additional buffer. Gamma correction and brightness
+   * are applied with 16-bit precision every time the pixels are sent, and the remaining fraction is carried
+   * over to the next frame. This makes fades at low brightness smooth, but the pixels have to be sent
+   * continuously and the smallest fractions only average out over up to 256 frames. Dithered lights should not
+   * be used as the source of a partition.
+   */
+  void set_dithering(bool dithering);
+  bool is_dithering() const;
+
+  /** Set the pixels in [start, end) to color.
+   *
+   * Like all bulk operations, the color correction is only calculated once for the whole range
+   * instead of for each pixel.
+   */
+  virtual void fill(int32_t start, int32_t end, const ESPColor &color);
+  /// Set all pixels to color.
+  void fill(const ESPColor &color);
+  /// Fade the pixels in [start, end) to black by amount (0 - no change, 255 - black).
+  virtual void fade_to_black(int32_t start, int32_t end, uint8_t amount);
+  /// Blend the pixels in [start, end) with color, alpha is the weight of color (0 - no change, 255 - only color).
+  virtual void blend(int32_t start, int32_t end, const ESPColor &color, uint8_t alpha);
+  /** Move the pixels in [start, end) by amount positions.
+   *
+   * Positive amounts move the pixels towards the end of the range, negative ones towards the start.
+   * Pixels that are moved out of the range are dropped, the vacated pixels keep their previous color.
+   */
+  virtual void shift(int32_t start, int32_t end, int32_t amount);
+  /// Write len colors from buffer to the pixels starting at start.
+  virtual void copy_from(int32_t start, const ESPColor *buffer, int32_t len);
 
  protected:
-  bool should_show_() const;
+  /** Backends that store their pixels in one contiguous buffer return it here.
+   *
+   * Bulk operations then work directly on that buffer instead of going through operator[] for each pixel.
+   *
+   * @return Whether buffer was filled.
+   */
+  virtual bool get_raw_buffer_(ESPRawPixelBuffer *buffer);  // NOLINT
+  bool clamp_range_(int32_t *start, int32_t *end) const;  // NOLINT
+  /// The color correction for writing pixels, does nothing if dithering is enabled as it's applied when sending.
+  const ESPColorCorrection &get_write_correction_() const;
+  /// Render the uncorrected pixels of the raw buffer to dst with 16-bit color correction and temporal dithering.
+  void render_dithered_(uint8_t *dst);
+#ifdef USE_LIGHT_FIXED_POINT
+  /// Gamma correct a 16-bit fixed point value with the 16-bit gamma table.
+  uint16_t gamma_correct16_(uint16_t value) const;
+#endif
+  /// Bulk operations with an explicit color correction, so that partitions can apply their own.
+  void fill_(int32_t start, int32_t end, const ESPColor &color, const ESPColorCorrection &correction);
+  void fade_to_black_(int32_t start, int32_t end, uint8_t amount, const ESPColorCorrection &correction);
+  void blend_(int32_t start, int32_t end, const ESPColor &color, uint8_t alpha, const ESPColorCorrection &correction);
+  void copy_from_(int32_t start, const ESPColor *buffer, int32_t len, const ESPColorCorrection &correction);
+
+  /** Whether the pixels should be sent to the strip, only true if they changed since the last show.
+   *
+   * The pixels are only compared if schedule_show() was called since the last show, effects do that after
+   * rendering each frame.
+   */
+  bool should_show_();
   void mark_shown_();
+  uint32_t hash_pixels_(const ESPRawPixelBuffer &buffer) const;  // NOLINT
 
   bool effect_active_{false};
   bool next_show_{true};
+  uint32_t min_refresh_interval_{0};
+  uint32_t last_show_{0};
+  uint32_t shown_hash_{0};
+  uint32_t pending_hash_{0};
+  uint32_t frames_shown_{0};
+  uint32_t frames_skipped_{0};
+  bool dithering_{false};
+  HighFrequencyLoopRequester dither_high_freq_;
+  float gamma_{0.0f};
+  /// 16-bit gamma table, only allocated when dithering is enabled.
+  uint16_t *gamma_table16_{nullptr};
+  /// Gamma corrected brightness with 16-bit precision.
+  uint16_t dither_brightness_{0};
+  /// The fraction of each channel that was not sent yet, allocated on the first dithered frame.
+  uint8_t *dither_error_{nullptr};
   ESPColorCorrection correction_{};
+
+  friend class PartitionLightOutput;
 };
 
 class AddressableSegment {
  public:
-  AddressableSegment(LightState *src, int32_t src_offset, int32_t size);
+  /** Create a segment of size pixels of src, starting at src_offset.
+   *
+   * @param reversed Whether the pixels of this segment should be addressed in reverse order.
+   */
+  AddressableSegment(LightState *src, int32_t src_offset, int32_t size, bool reversed = false);
 
   AddressableLight *get_src() const;
   int32_t get_src_offset() const;
   int32_t get_size() const;
   int32_t get_dst_offset() const;
   void set_dst_offset(int32_t dst_offset);
+  bool is_reversed() const;
+  /// Get the index in the source light of the pixel at dst_index of the partition.
+  inline int32_t get_src_index(int32_t dst_index) const ALWAYS_INLINE;
+  /// Map the part of the range [start, end) of the partition in this segment to a range of the source light.
+  bool get_src_range(int32_t start, int32_t end, int32_t *src_start, int32_t *src_end) const;
 
  protected:
   AddressableLight *src_;
   int32_t src_offset_;
   int32_t size_;
   int32_t dst_offset_;
+  bool reversed_;
 };
 
+/** A light made up of segments of other addressable lights.
+ *
+ * The segments may come from different strips and may be reversed. Bulk operations are forwarded
+ * to the source lights segment by segment, single pixel accesses first check the segment of the
+ * previous access as effects usually access pixels in order.
+ */
 class PartitionLightOutput : public AddressableLight, public Component {
  public:
   PartitionLightOutput(const std::vector<AddressableSegment> &segments);
@@ -186,9 +304,16 @@ class PartitionLightOutput : public AddressableLight, public Component {
   void clear_effect_data() override;
   LightTraits get_traits() override;
   void loop() override;
+  void fill(int32_t start, int32_t end, const ESPColor &color) override;
+  void fade_to_black(int32_t start, int32_t end, uint8_t amount) override;
+  void blend(int32_t start, int32_t end, const ESPColor &color, uint8_t alpha) override;
+  void copy_from(int32_t start, const ESPColor *buffer, int32_t len) override;
 
  protected:
+  const AddressableSegment &find_segment_(int32_t index) const;
+
   std::vector<AddressableSegment> segments_;
+  mutable size_t last_segment_{0};
 };
 
 }  // namespace light
@@ -216,6 +216,15 @@ const ESPColorView &ESPColorView::operator=(const ESPHSVColor &rhs) const {
 void ESPColorView::raw_set_color_correction(const ESPColorCorrection *color_correction) {
   this->color_correction_ = color_correction;
 }
+void ESPColorView::raw_copy_from(const ESPColorView &other) const {
+  *this->red_ = *other.red_;
+  *this->green_ = *other.green_;
+  *this->blue_ = *other.blue_;
+  if (this->white_ != nullptr && other.white_ != nullptr)
+    *this->white_ = *other.white_;
+  if (this->effect_data_ != nullptr && other.effect_data_ != nullptr)
+    *this->effect_data_ = *other.effect_data_;
+}
 
 ESPColor ESPColorCorrection::color_correct(ESPColor color) const {
   // corrected = (uncorrected * max_brightness * local_brightness) ^ gamma
@@ -282,6 +291,13 @@ uint8_t ESPColorCorrection::color_uncorrect_white(uint8_t white) const {
   return res;
 }
 
+int32_t AddressableSegment::get_src_index(int32_t dst_index) const {
+  const int32_t seg_off = dst_index - this->dst_offset_;
+  if (this->reversed_)
+    return this->src_offset_ + this->size_ - 1 - seg_off;
+  return this->src_offset_ + seg_off;
+}
+
 ESPHSVColor::ESPHSVColor() : h(0), s(0), v(0) {  // NOLINT
 }
 
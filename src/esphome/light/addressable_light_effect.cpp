@@ -33,6 +33,8 @@ void AddressableLightEffect::apply() {
       ESPColor(static_cast<uint8_t>(color.get_red() * 255), static_cast<uint8_t>(color.get_green() * 255),
                static_cast<uint8_t>(color.get_blue() * 255), static_cast<uint8_t>(color.get_white() * 255));
   this->apply(*this->get_addressable_(), current_color);
+  // the effect rendered a frame, show it if any pixel changed
+  this->get_addressable_()->schedule_show();
 }
 
 inline static int16_t sin16_c(uint16_t theta) {
@@ -77,6 +79,7 @@ void AddressableRainbowLightEffect::apply(AddressableLight &it, const ESPColor &
   const uint16_t add = 0xFFFF / this->width_;
   for (int i = 0; i < it.size(); i++) {
     hsv.hue = hue >> 8;
+    // only sets the RGB channels, the white channel is left alone
     it[i] = hsv;
     hue += add;
   }
@@ -106,15 +109,7 @@ void AddressableColorWipeEffect::apply(AddressableLight &it, const ESPColor &cur
   if (now - this->last_add_ < this->add_led_interval_)
     return;
   this->last_add_ = now;
-  if (!this->reverse_) {
-    for (int i = 0; i < it.size() - 1; i++) {
-      it[i] = it[i + 1].get();
-    }
-  } else {
-    for (int i = it.size() - 1; i > 0; i--) {
-      it[i] = it[i - 1].get();
-    }
-  }
+  it.shift(0, it.size(), this->reverse_ ? 1 : -1);
   const AddressableColorWipeEffectColor color = this->colors_[this->at_color_];
   const ESPColor esp_color = ESPColor(color.r, color.g, color.b, color.w);
   if (!this->reverse_) {
@@ -140,12 +135,8 @@ AddressableScanEffect::AddressableScanEffect(const std::string &name) : Addressa
 void AddressableScanEffect::set_move_interval(uint32_t move_interval) { this->move_interval_ = move_interval; }
 
 void AddressableScanEffect::apply(AddressableLight &addressable, const ESPColor &current_color) {
-  for (int i = 0; i < addressable.size(); i++) {
-    if (i == this->at_led_)
-      addressable[i] = current_color;
-    else
-      addressable[i] = ESPColor(0, 0, 0, 0);
-  }
+  addressable.fill(ESPColor(0, 0, 0, 0));
+  addressable[this->at_led_] = current_color;
   const uint32_t now = millis();
   if (now - this->last_move_ > this->move_interval_) {
     if (direction_) {
@@ -252,9 +243,7 @@ void AddressableRandomTwinkleEffect::set_progress_interval(uint32_t progress_int
 AddressableFireworksEffect::AddressableFireworksEffect(const std::string &name) : AddressableLightEffect(name) {}
 
 void AddressableFireworksEffect::start() {
-  const auto &it = *this->get_addressable_();
-  for (int i = 0; i < it.size(); i++)
-    it[i] = ESPColor(0, 0, 0, 0);
+  this->get_addressable_()->fill(ESPColor(0, 0, 0, 0));
 }
 
 void AddressableFireworksEffect::apply(AddressableLight &it, const ESPColor &current_color) {
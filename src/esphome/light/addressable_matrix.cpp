@@ -0,0 +1,146 @@
+#include "esphome/defines.h"
+
+#ifdef USE_LIGHT
+
+#include "esphome/light/addressable_matrix.h"
+
+ESPHOME_NAMESPACE_BEGIN
+
+namespace light {
+
+AddressableMatrix::AddressableMatrix(AddressableLight *light, uint16_t panel_width, uint16_t panel_height)
+    : light_(light), panel_width_(panel_width), panel_height_(panel_height) {
+  this->build_table_();
+}
+void AddressableMatrix::set_layout(AddressableMatrixLayout layout) {
+  this->layout_ = layout;
+  this->build_table_();
+}
+void AddressableMatrix::set_rotation(AddressableMatrixRotation rotation) {
+  this->rotation_ = rotation;
+  this->build_table_();
+}
+void AddressableMatrix::set_tiles(uint8_t tiles_x, uint8_t tiles_y, bool serpentine) {
+  this->tiles_x_ = tiles_x;
+  this->tiles_y_ = tiles_y;
+  this->tile_serpentine_ = serpentine;
+  this->build_table_();
+}
+int AddressableMatrix::get_width() const { return this->width_; }
+int AddressableMatrix::get_height() const { return this->height_; }
+AddressableLight *AddressableMatrix::get_light() const { return this->light_; }
+bool AddressableMatrix::is_in_bounds(int x, int y) const {
+  return x >= 0 && y >= 0 && x < this->width_ && y < this->height_;
+}
+uint16_t AddressableMatrix::physical_index_(int x, int y) const {
+  const int tile_x = x / this->panel_width_;
+  const int tile_y = y / this->panel_height_;
+  x %= this->panel_width_;
+  y %= this->panel_height_;
+
+  int tile = tile_y * this->tiles_x_;
+  if (this->tile_serpentine_ && (tile_y & 1))
+    tile += this->tiles_x_ - 1 - tile_x;
+  else
+    tile += tile_x;
+
+  int local;
+  switch (this->layout_) {
+    case AddressableMatrixLayout::SERPENTINE:
+      local = y * this->panel_width_ + ((y & 1) ? this->panel_width_ - 1 - x : x);
+      break;
+    case AddressableMatrixLayout::COLUMN_MAJOR:
+      local = x * this->panel_height_ + y;
+      break;
+    case AddressableMatrixLayout::COLUMN_SERPENTINE:
+      local = x * this->panel_height_ + ((x & 1) ? this->panel_height_ - 1 - y : y);
+      break;
+    case AddressableMatrixLayout::ROW_MAJOR:
+    default:
+      local = y * this->panel_width_ + x;
+      break;
+  }
+  return tile * this->panel_width_ * this->panel_height_ + local;
+}
+void AddressableMatrix::build_table_() {
+  const int physical_width = this->panel_width_ * this->tiles_x_;
+  const int physical_height = this->panel_height_ * this->tiles_y_;
+  const bool swap = this->rotation_ == MATRIX_ROTATION_90_DEGREES || this->rotation_ == MATRIX_ROTATION_270_DEGREES;
+  this->width_ = swap ? physical_height : physical_width;
+  this->height_ = swap ? physical_width : physical_height;
+
+  this->table_.resize(this->width_ * this->height_);
+  for (int y = 0; y < this->height_; y++) {
+    for (int x = 0; x < this->width_; x++) {
+      // same rotation logic as DisplayBuffer::draw_pixel_at
+      int phys_x = x, phys_y = y;
+      switch (this->rotation_) {
+        case MATRIX_ROTATION_90_DEGREES:
+          phys_x = physical_width - y - 1;
+          phys_y = x;
+          break;
+        case MATRIX_ROTATION_180_DEGREES:
+          phys_x = physical_width - x - 1;
+          phys_y = physical_height - y - 1;
+          break;
+        case MATRIX_ROTATION_270_DEGREES:
+          phys_x = y;
+          phys_y = physical_height - x - 1;
+          break;
+        case MATRIX_ROTATION_0_DEGREES:
+        default:
+          break;
+      }
+      this->table_[y * this->width_ + x] = this->physical_index_(phys_x, phys_y);
+    }
+  }
+}
+void AddressableMatrix::fill(const ESPColor &color) {
+  // the table is a permutation of the first width*height pixels
+  this->light_->fill(0, this->width_ * this->height_, color);
+}
+void HOT AddressableMatrix::draw_row(int y, const ESPColor &color) {
+  if (y < 0 || y >= this->height_)
+    return;
+  for (int x = 0; x < this->width_; x++)
+    (*this)(x, y) = color;
+}
+void HOT AddressableMatrix::draw_column(int x, const ESPColor &color) {
+  if (x < 0 || x >= this->width_)
+    return;
+  for (int y = 0; y < this->height_; y++)
+    (*this)(x, y) = color;
+}
+void HOT AddressableMatrix::scroll(int dx, int dy, const ESPColor &fill) {
+  if (dx == 0 && dy == 0)
+    return;
+  // iterate against the scroll direction so that source pixels are read before they are overwritten
+  for (int i = 0; i < this->height_; i++) {
+    const int y = dy > 0 ? this->height_ - 1 - i : i;
+    for (int j = 0; j < this->width_; j++) {
+      const int x = dx > 0 ? this->width_ - 1 - j : j;
+      const int src_x = x - dx;
+      const int src_y = y - dy;
+      if (this->is_in_bounds(src_x, src_y)) {
+        // move the pixel as it's stored, together with its effect data
+        (*this)(x, y).raw_copy_from((*this)(src_x, src_y));
+      } else {
+        (*this)(x, y) = fill;
+      }
+    }
+  }
+}
+void HOT AddressableMatrix::blit(int x, int y, int width, int height, const ESPColor *frame) {
+  for (int frame_y = 0; frame_y < height; frame_y++) {
+    for (int frame_x = 0; frame_x < width; frame_x++) {
+      if (this->is_in_bounds(x + frame_x, y + frame_y))
+        (*this)(x + frame_x, y + frame_y) = frame[frame_y * width + frame_x];
+    }
+  }
+}
+
+}  // namespace light
+
+ESPHOME_NAMESPACE_END
+
+#endif  // USE_LIGHT
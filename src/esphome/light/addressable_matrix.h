@@ -0,0 +1,124 @@
+#ifndef ESPHOME_LIGHT_ADDRESSABLE_MATRIX_H
+#define ESPHOME_LIGHT_ADDRESSABLE_MATRIX_H
+
+#include "esphome/defines.h"
+
+#ifdef USE_LIGHT
+
+#include <vector>
+#include "esphome/light/addressable_light.h"
+
+ESPHOME_NAMESPACE_BEGIN
+
+namespace light {
+
+/// How the pixels of a single panel are wired.
+enum class AddressableMatrixLayout {
+  /// All rows go from left to right.
+  ROW_MAJOR = 0,
+  /// Even rows go from left to right, odd rows from right to left.
+  SERPENTINE,
+  /// All columns go from top to bottom.
+  COLUMN_MAJOR,
+  /// Even columns go from top to bottom, odd columns from bottom to top.
+  COLUMN_SERPENTINE,
+};
+
+enum AddressableMatrixRotation {
+  MATRIX_ROTATION_0_DEGREES = 0,
+  MATRIX_ROTATION_90_DEGREES = 90,
+  MATRIX_ROTATION_180_DEGREES = 180,
+  MATRIX_ROTATION_270_DEGREES = 270,
+};
+
+/** Two-dimensional view of an addressable light wired as an LED matrix.
+ *
+ * The matrix can be made of multiple equal panels (tiles) that are chained row by row. The mapping
+ * from x/y coordinates to the pixel index is calculated once and stored in a table, so that
+ * accessing a pixel by its coordinates costs a single table lookup.
+ *
+ * ```cpp
+ * auto *matrix = new light::AddressableMatrix(fast_led, 16, 16);
+ * matrix->set_layout(light::AddressableMatrixLayout::SERPENTINE);
+ * // in a lambda effect:
+ * (*matrix)(x, y) = light::ESPColor(255, 0, 0);
+ * ```
+ */
+class AddressableMatrix {
+ public:
+  /** Create a matrix on light.
+   *
+   * @param light The addressable light the matrix is wired to.
+   * @param panel_width The width of a single panel in pixels.
+   * @param panel_height The height of a single panel in pixels.
+   */
+  AddressableMatrix(AddressableLight *light, uint16_t panel_width, uint16_t panel_height);
+
+  /// Set how the pixels of each panel are wired, defaults to ROW_MAJOR.
+  void set_layout(AddressableMatrixLayout layout);
+  /// Set the rotation of the whole matrix.
+  void set_rotation(AddressableMatrixRotation rotation);
+  /** Use multiple panels of the same size.
+   *
+   * @param tiles_x The number of panels next to each other.
+   * @param tiles_y The number of panel rows.
+   * @param serpentine Whether odd panel rows are chained from right to left.
+   */
+  void set_tiles(uint8_t tiles_x, uint8_t tiles_y, bool serpentine = false);
+
+  /// Get the width of the matrix in pixels with rotation applied.
+  int get_width() const;
+  /// Get the height of the matrix in pixels with rotation applied.
+  int get_height() const;
+  AddressableLight *get_light() const;
+  bool is_in_bounds(int x, int y) const;
+
+  /// Get the index in the light of the pixel at x/y, coordinates are not checked.
+  inline int32_t get_index(int x, int y) const ALWAYS_INLINE { return this->table_[y * this->width_ + x]; }
+  /// Access the pixel at x/y, coordinates are not checked.
+  inline ESPColorView operator()(int x, int y) const ALWAYS_INLINE {
+    return (*this->light_)[this->get_index(x, y)];
+  }
+
+  /// Set all pixels of the matrix to color.
+  void fill(const ESPColor &color);
+  /// Set all pixels in row y to color.
+  void draw_row(int y, const ESPColor &color);
+  /// Set all pixels in column x to color.
+  void draw_column(int x, const ESPColor &color);
+  /** Move the contents of the matrix by dx/dy pixels.
+   *
+   * Pixels moved out of the matrix are dropped, the vacated pixels are set to fill. Pixels are moved as they are
+   * stored, together with their effect data, so repeated scrolling doesn't change their colors.
+   */
+  void scroll(int dx, int dy, const ESPColor &fill = ESPColor(0, 0, 0, 0));
+  /// Copy a width x height frame (row-major) to the matrix with its top left corner at x/y.
+  void blit(int x, int y, int width, int height, const ESPColor *frame);
+
+ protected:
+  /// Calculate the index of a pixel without rotation.
+  uint16_t physical_index_(int x, int y) const;
+  void build_table_();
+
+  AddressableLight *light_;
+  uint16_t panel_width_;
+  uint16_t panel_height_;
+  uint8_t tiles_x_{1};
+  uint8_t tiles_y_{1};
+  bool tile_serpentine_{false};
+  AddressableMatrixLayout layout_{AddressableMatrixLayout::ROW_MAJOR};
+  AddressableMatrixRotation rotation_{MATRIX_ROTATION_0_DEGREES};
+  /// Width and height with rotation applied.
+  int width_;
+  int height_;
+  /// Pixel index for each x/y coordinate in row-major order.
+  std::vector<uint16_t> table_;
+};
+
+}  // namespace light
+
+ESPHOME_NAMESPACE_END
+
+#endif  // USE_LIGHT
+
+#endif  // ESPHOME_LIGHT_ADDRESSABLE_MATRIX_H
@@ -0,0 +1,244 @@
+#include "esphome/defines.h"
+
+#ifdef USE_LIGHT
+
+#include "esphome/light/addressable_stream_effect.h"
+#include "esphome/log.h"
+#include <algorithm>
+#include <cstring>
+
+ESPHOME_NAMESPACE_BEGIN
+
+namespace light {
+
+static const char *TAG = "light.addressable_stream";
+
+/// Maximum payload of a UDP packet without fragmentation.
+static const size_t STREAM_BUFFER_SIZE = 1472;
+/// Maximum number of packets handled per loop iteration.
+static const uint8_t STREAM_MAX_PACKETS_PER_LOOP = 32;
+static const uint32_t STREAM_STATS_INTERVAL = 10000;
+
+static const uint16_t E131_DEFAULT_PORT = 5568;
+static const uint16_t ARTNET_DEFAULT_PORT = 6454;
+static const uint16_t DDP_DEFAULT_PORT = 4048;
+
+static const uint8_t E131_ACN_ID[12] = {0x41, 0x53, 0x43, 0x2d, 0x45, 0x31, 0x2e, 0x31, 0x37, 0x00, 0x00, 0x00};
+static const size_t E131_HEADER_SIZE = 126;
+static const uint8_t E131_OPTION_TERMINATED = 0x40;
+static const uint8_t ARTNET_ID[8] = {'A', 'r', 't', '-', 'N', 'e', 't', 0x00};
+static const uint16_t ARTNET_OPCODE_DMX = 0x5000;
+static const size_t ARTNET_HEADER_SIZE = 18;
+static const size_t DDP_HEADER_SIZE = 10;
+static const uint8_t DDP_FLAG_VERSION_MASK = 0xC0;
+static const uint8_t DDP_FLAG_VERSION_1 = 0x40;
+static const uint8_t DDP_FLAG_TIMECODE = 0x10;
+static const uint8_t DDP_FLAG_PUSH = 0x01;
+
+static inline uint16_t read_u16_be(const uint8_t *data) { return (uint16_t(data[0]) << 8) | data[1]; }
+static inline uint32_t read_u32_be(const uint8_t *data) {
+  return (uint32_t(data[0]) << 24) | (uint32_t(data[1]) << 16) | (uint32_t(data[2]) << 8) | data[3];
+}
+
+AddressableStreamEffect::AddressableStreamEffect(const std::string &name) : AddressableLightEffect(name) {}
+
+void AddressableStreamEffect::start() {
+  if (this->buffer_ == nullptr)
+    this->buffer_ = new uint8_t[STREAM_BUFFER_SIZE];
+  const int32_t size = this->get_addressable_()->size();
+  this->sequences_.assign((size + this->leds_per_universe_ - 1) / this->leds_per_universe_, -1);
+  this->frame_universes_.assign(this->sequences_.size(), false);
+  this->ddp_sequence_ = 0;
+  this->last_stats_ = millis();
+  this->last_stats_packets_ = this->packets_received_;
+  this->last_stats_frames_ = this->frames_received_;
+  this->udp_.begin(this->port_);
+  ESP_LOGD(TAG, "Listening for pixel data on UDP port %u", this->port_);
+}
+
+void AddressableStreamEffect::stop() {
+  this->udp_.stop();
+  AddressableLightEffect::stop();
+}
+
+void AddressableStreamEffect::apply(AddressableLight &it, const ESPColor &current_color) {
+  for (uint8_t i = 0; i < STREAM_MAX_PACKETS_PER_LOOP; i++) {
+    const int len = this->udp_.parsePacket();
+    if (len <= 0)
+      break;
+    const int read = this->udp_.read(this->buffer_, STREAM_BUFFER_SIZE);
+    if (read <= 0)
+      continue;
+    this->packets_received_++;
+    this->handle_packet_(it, this->buffer_, read);
+  }
+
+  if (millis() - this->last_stats_ >= STREAM_STATS_INTERVAL)
+    this->log_stats_();
+}
+
+bool AddressableStreamEffect::handle_packet_(AddressableLight &it, const uint8_t *data, size_t len) {
+  switch (this->protocol_) {
+    case StreamProtocol::E131:
+      return this->handle_e131_(it, data, len);
+    case StreamProtocol::ARTNET:
+      return this->handle_artnet_(it, data, len);
+    case StreamProtocol::DDP:
+      return this->handle_ddp_(it, data, len);
+    default:
+      return false;
+  }
+}
+
+bool AddressableStreamEffect::handle_e131_(AddressableLight &it, const uint8_t *data, size_t len) {
+  if (len < E131_HEADER_SIZE || memcmp(data + 4, E131_ACN_ID, sizeof(E131_ACN_ID)) != 0)
+    return false;
+  // root vector VECTOR_ROOT_E131_DATA, framing vector VECTOR_E131_DATA_PACKET, DMP vector SET_PROPERTY
+  if (read_u32_be(data + 18) != 0x00000004 || read_u32_be(data + 40) != 0x00000002 || data[117] != 0x02)
+    return false;
+  if (data[112] & E131_OPTION_TERMINATED)
+    return false;
+  const uint16_t universe = read_u16_be(data + 113);
+  if (!this->check_sequence_(universe, data[111]))
+    return false;
+  // property value count includes the DMX start code, which must be 0 for pixel data
+  const uint16_t count = read_u16_be(data + 123);
+  if (count < 1 || data[125] != 0x00)
+    return false;
+  const size_t channels = std::min(size_t(count - 1), len - E131_HEADER_SIZE);
+  this->write_universe_(it, universe, data + E131_HEADER_SIZE, channels);
+  return true;
+}
+
+bool AddressableStreamEffect::handle_artnet_(AddressableLight &it, const uint8_t *data, size_t len) {
+  if (len < ARTNET_HEADER_SIZE || memcmp(data, ARTNET_ID, sizeof(ARTNET_ID)) != 0)
+    return false;
+  // opcode is little endian
+  const uint16_t opcode = data[8] | (uint16_t(data[9]) << 8);
+  if (opcode != ARTNET_OPCODE_DMX)
+    return false;
+  // 15-bit port address: net (7 bits) followed by sub-net and universe
+  const uint16_t universe = data[14] | (uint16_t(data[15] & 0x7F) << 8);
+  // sequence 0 means the sender doesn't use sequence numbers
+  if (data[12] != 0 && !this->check_sequence_(universe, data[12]))
+    return false;
+  const size_t channels = std::min(size_t(read_u16_be(data + 16)), len - ARTNET_HEADER_SIZE);
+  this->write_universe_(it, universe, data + ARTNET_HEADER_SIZE, channels);
+  return true;
+}
+
+bool AddressableStreamEffect::handle_ddp_(AddressableLight &it, const uint8_t *data, size_t len) {
+  if (len < DDP_HEADER_SIZE || (data[0] & DDP_FLAG_VERSION_MASK) != DDP_FLAG_VERSION_1)
+    return false;
+  const uint8_t flags = data[0];
+  const size_t header = (flags & DDP_FLAG_TIMECODE) ? DDP_HEADER_SIZE + 4 : DDP_HEADER_SIZE;
+  if (len < header)
+    return false;
+
+  // 4-bit sequence number, 0 means unused; drop packets that are up to half the range behind
+  const uint8_t sequence = data[1] & 0x0F;
+  if (sequence != 0) {
+    if (this->ddp_sequence_ != 0 && ((sequence - this->ddp_sequence_) & 0x0F) >= 8) {
+      this->packets_dropped_++;
+      return false;
+    }
+    this->ddp_sequence_ = sequence;
+  }
+
+  const uint32_t offset = read_u32_be(data + 4);
+  const size_t length = std::min(size_t(read_u16_be(data + 8)), len - header);
+  this->write_pixels_(it, offset / this->channels_per_led_, data + header, length);
+  if (flags & DDP_FLAG_PUSH)
+    this->frames_received_++;
+  return true;
+}
+
+bool AddressableStreamEffect::check_sequence_(uint16_t universe, uint8_t sequence) {
+  if (universe < this->first_universe_ || size_t(universe - this->first_universe_) >= this->sequences_.size())
+    return true;
+  int16_t &last = this->sequences_[universe - this->first_universe_];
+  // same rule as E1.31: packets up to 20 sequence numbers behind the last one are late
+  const auto diff = static_cast<int8_t>(sequence - uint8_t(last));
+  if (last != -1 && diff <= 0 && diff > -20) {
+    this->packets_dropped_++;
+    return false;
+  }
+  last = sequence;
+  return true;
+}
+
+void AddressableStreamEffect::write_universe_(AddressableLight &it, uint16_t universe, const uint8_t *data,
+                                              size_t len) {
+  if (universe < this->first_universe_)
+    return;
+  // E1.31 and Art-Net have no end of frame marker, a frame is complete once one of its universes arrives again.
+  const size_t index = universe - this->first_universe_;
+  if (index < this->frame_universes_.size()) {
+    if (this->frame_universes_[index]) {
+      this->frames_received_++;
+      std::fill(this->frame_universes_.begin(), this->frame_universes_.end(), false);
+    }
+    this->frame_universes_[index] = true;
+  }
+  const int32_t offset = int32_t(universe - this->first_universe_) * this->leds_per_universe_;
+  len = std::min(len, size_t(this->leds_per_universe_) * this->channels_per_led_);
+  this->write_pixels_(it, offset, data, len);
+}
+
+void HOT AddressableStreamEffect::write_pixels_(AddressableLight &it, int32_t offset, const uint8_t *data,
+                                                size_t len) {
+  // convert in chunks so that the pixels can be written with the bulk API
+  ESPColor chunk[32];
+  const uint8_t step = this->channels_per_led_;
+  size_t leds = len / step;
+  while (leds > 0 && offset < it.size()) {
+    const size_t count = std::min(leds, size_t(32));
+    for (size_t i = 0; i < count; i++, data += step)
+      chunk[i] = ESPColor(data[0], data[1], data[2], step == 4 ? data[3] : 0);
+    it.copy_from(offset, chunk, count);
+    offset += count;
+    leds -= count;
+  }
+}
+
+void AddressableStreamEffect::log_stats_() {
+  const uint32_t now = millis();
+  const float seconds = (now - this->last_stats_) / 1000.0f;
+  const uint32_t packets = this->packets_received_ - this->last_stats_packets_;
+  const uint32_t frames = this->frames_received_ - this->last_stats_frames_;
+  ESP_LOGD(TAG, "'%s': %.1f packets/s, %.1f frames/s, %u dropped in total", this->name_.c_str(), packets / seconds,
+           frames / seconds, this->packets_dropped_);
+  this->last_stats_ = now;
+  this->last_stats_packets_ = this->packets_received_;
+  this->last_stats_frames_ = this->frames_received_;
+}
+
+void AddressableStreamEffect::set_protocol(StreamProtocol protocol) {
+  this->protocol_ = protocol;
+  switch (protocol) {
+    case StreamProtocol::E131:
+      this->port_ = E131_DEFAULT_PORT;
+      break;
+    case StreamProtocol::ARTNET:
+      this->port_ = ARTNET_DEFAULT_PORT;
+      break;
+    case StreamProtocol::DDP:
+      this->port_ = DDP_DEFAULT_PORT;
+      break;
+  }
+}
+void AddressableStreamEffect::set_port(uint16_t port) { this->port_ = port; }
+void AddressableStreamEffect::set_first_universe(uint16_t first_universe) { this->first_universe_ = first_universe; }
+void AddressableStreamEffect::set_leds_per_universe(uint16_t leds_per_universe) {
+  this->leds_per_universe_ = leds_per_universe;
+}
+void AddressableStreamEffect::set_rgbw(bool rgbw) { this->channels_per_led_ = rgbw ? 4 : 3; }
+uint32_t AddressableStreamEffect::get_packets_received() const { return this->packets_received_; }
+uint32_t AddressableStreamEffect::get_packets_dropped() const { return this->packets_dropped_; }
+uint32_t AddressableStreamEffect::get_frames_received() const { return this->frames_received_; }
+
+}  // namespace light
+
+ESPHOME_NAMESPACE_END
+
+#endif  // USE_LIGHT
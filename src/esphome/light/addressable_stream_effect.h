@@ -0,0 +1,96 @@
+#ifndef ESPHOME_LIGHT_ADDRESSABLE_STREAM_EFFECT_H
+#define ESPHOME_LIGHT_ADDRESSABLE_STREAM_EFFECT_H
+
+#include "esphome/defines.h"
+
+#ifdef USE_LIGHT
+
+#include <vector>
+#include <WiFiUdp.h>
+#include "esphome/light/addressable_light_effect.h"
+
+ESPHOME_NAMESPACE_BEGIN
+
+namespace light {
+
+enum class StreamProtocol {
+  E131 = 0,
+  ARTNET,
+  DDP,
+};
+
+/** Addressable light effect that shows pixel data streamed over UDP (E1.31/sACN, Art-Net or DDP).
+ *
+ * For E1.31 and Art-Net each universe maps to a range of LEDs starting at first_universe, DDP packets
+ * contain the offset in the pixel buffer themselves. Packets that arrive out of order are dropped, if several
+ * packets for the same universe arrive within one loop iteration only the newest one is shown.
+ *
+ * Only unicast packets are received. Note that the data goes through the color correction of the light,
+ * set the gamma correction of the light to 1.0 if the sender already corrects the colors.
+ */
+class AddressableStreamEffect : public AddressableLightEffect {
+ public:
+  explicit AddressableStreamEffect(const std::string &name);
+
+  void start() override;
+  void stop() override;
+  void apply(AddressableLight &it, const ESPColor &current_color) override;
+
+  /// Set the protocol to receive, this also sets the port to the default port of the protocol.
+  void set_protocol(StreamProtocol protocol);
+  void set_port(uint16_t port);
+  /// Set the universe mapped to the first LED (E1.31 and Art-Net only).
+  void set_first_universe(uint16_t first_universe);
+  /// Set the number of LEDs in each universe, defaults to 170 (510 channels).
+  void set_leds_per_universe(uint16_t leds_per_universe);
+  /// Whether each LED uses 4 channels (RGBW) instead of 3 (RGB).
+  void set_rgbw(bool rgbw);
+
+  uint32_t get_packets_received() const;
+  uint32_t get_packets_dropped() const;
+  /** Get the number of complete frames received.
+   *
+   * DDP frames end with a packet with the push flag. E1.31 and Art-Net frames are counted when a universe of the
+   * next frame arrives.
+   */
+  uint32_t get_frames_received() const;
+
+ protected:
+  /// Parse a packet and write its pixel data, returns whether any pixel was written.
+  bool handle_packet_(AddressableLight &it, const uint8_t *data, size_t len);
+  bool handle_e131_(AddressableLight &it, const uint8_t *data, size_t len);
+  bool handle_artnet_(AddressableLight &it, const uint8_t *data, size_t len);
+  bool handle_ddp_(AddressableLight &it, const uint8_t *data, size_t len);
+  /// Check the sequence number of a universe, returns false if the packet is late.
+  bool check_sequence_(uint16_t universe, uint8_t sequence);
+  void write_universe_(AddressableLight &it, uint16_t universe, const uint8_t *data, size_t len);
+  void write_pixels_(AddressableLight &it, int32_t offset, const uint8_t *data, size_t len);
+  void log_stats_();
+
+  WiFiUDP udp_;
+  uint8_t *buffer_{nullptr};
+  StreamProtocol protocol_{StreamProtocol::E131};
+  uint16_t port_{5568};
+  uint16_t first_universe_{1};
+  uint16_t leds_per_universe_{170};
+  uint8_t channels_per_led_{3};
+  /// Last sequence number of each universe relative to first_universe, -1 if none was received yet.
+  std::vector<int16_t> sequences_;
+  /// Which universes relative to first_universe were received in the current frame.
+  std::vector<bool> frame_universes_;
+  uint8_t ddp_sequence_{0};
+  uint32_t packets_received_{0};
+  uint32_t packets_dropped_{0};
+  uint32_t frames_received_{0};
+  uint32_t last_stats_{0};
+  uint32_t last_stats_packets_{0};
+  uint32_t last_stats_frames_{0};
+};
+
+}  // namespace light
+
+ESPHOME_NAMESPACE_END
+
+#endif  // USE_LIGHT
+
+#endif  // ESPHOME_LIGHT_ADDRESSABLE_STREAM_EFFECT_H
@@ -0,0 +1,327 @@
+#include "esphome/defines.h"
+
+#ifdef USE_ESP32_RMT_LED_STRIP
+
+#include "esphome/light/esp32_rmt_led_strip.h"
+#include "esphome/helpers.h"
+#include "esphome/log.h"
+
+#include <algorithm>
+
+ESPHOME_NAMESPACE_BEGIN
+
+namespace light {
+
+static const char *TAG = "light.esp32_rmt_led_strip";
+
+/// With a clock divider of 2 one RMT tick is 25ns.
+static const uint8_t RMT_CLOCK_DIVIDER = 2;
+/// Time the data line has to stay low after a frame so that the LEDs latch it (280µs for newer WS2812B).
+static const uint32_t RMT_LED_LATCH_TIME = 300;
+
+/// Build an RMT item for one bit: high for high_ticks, then low for low_ticks.
+static constexpr uint32_t rmt_led_bit(uint32_t high_ticks, uint32_t low_ticks) {
+  return high_ticks | (1UL << 15) | (low_ticks << 16);
+}
+
+// timings in 25ns ticks: high/low time of a 0 bit, then of a 1 bit
+static const uint32_t RMT_LED_SK6812_BIT0 = rmt_led_bit(12, 36);
+static const uint32_t RMT_LED_SK6812_BIT1 = rmt_led_bit(24, 24);
+static const uint32_t RMT_LED_WS2811_BIT0 = rmt_led_bit(20, 80);
+static const uint32_t RMT_LED_WS2811_BIT1 = rmt_led_bit(48, 52);
+static const uint32_t RMT_LED_WS2812_BIT0 = rmt_led_bit(16, 34);
+static const uint32_t RMT_LED_WS2812_BIT1 = rmt_led_bit(32, 18);
+
+#ifndef ESP32_RMT_LED_STRIP_TRANSLATOR
+/// Number of RMT items in one half of the channel memory, one interrupt converts this many bits.
+static const uint8_t RMT_LED_HALF_ITEMS = 32;
+/// The strips by channel for the shared RMT interrupt.
+static ESP32RMTLEDStripLightOutput *rmt_led_strips[RMT_CHANNEL_MAX] = {nullptr};
+static rmt_isr_handle_t rmt_led_isr_handle = nullptr;
+#endif
+
+#ifdef ESP32_RMT_LED_STRIP_TRANSLATOR
+/** Convert pixel bytes to RMT items, MSB first. Called by the RMT driver from its interrupt whenever the channel
+ * memory has room for more items, so this has to be in IRAM.
+ *
+ * The translator doesn't get any context, so the bit timings are template parameters.
+ */
+template<uint32_t BIT0, uint32_t BIT1>
+static void IRAM_ATTR rmt_led_translate(const void *src, rmt_item32_t *dest, size_t src_size, size_t wanted_num,
+                                        size_t *translated_size, size_t *item_num) {
+  if (src == nullptr || dest == nullptr) {
+    *translated_size = 0;
+    *item_num = 0;
+    return;
+  }
+  const auto *data = reinterpret_cast<const uint8_t *>(src);
+  size_t size = 0;
+  size_t num = 0;
+  while (size < src_size && num + 8 <= wanted_num) {
+    const uint8_t byte = data[size];
+    for (uint8_t mask = 0x80; mask != 0; mask >>= 1) {
+      dest->val = (byte & mask) ? BIT1 : BIT0;
+      dest++;
+    }
+    num += 8;
+    size++;
+  }
+  *translated_size = size;
+  *item_num = num;
+}
+#endif
+
+ESP32RMTLEDStripLightOutput::ESP32RMTLEDStripLightOutput(GPIOPin *pin, uint16_t num_leds,
+                                                         ESP32RMTLEDChipset chipset)
+    : pin_(pin), num_leds_(num_leds), chipset_(chipset) {
+  this->channel_ = select_next_rmt_channel();
+}
+void ESP32RMTLEDStripLightOutput::set_channel(rmt_channel_t channel) { this->channel_ = channel; }
+void ESP32RMTLEDStripLightOutput::set_rgb_order(ESP32RMTLEDOrder order) {
+  // offsets of red, green and blue in the data sent to the LEDs, in the order of ESP32RMTLEDOrder
+  static const uint8_t OFFSETS[6][3] = {{0, 1, 2}, {0, 2, 1}, {1, 0, 2}, {2, 0, 1}, {1, 2, 0}, {2, 1, 0}};
+  const uint8_t *offsets = OFFSETS[static_cast<uint8_t>(order)];
+  for (uint8_t i = 0; i < 3; i++)
+    this->rgb_offsets_[i] = offsets[i];
+}
+void ESP32RMTLEDStripLightOutput::set_rgbw(bool rgbw) { this->rgbw_ = rgbw; }
+#ifdef USE_OUTPUT
+void ESP32RMTLEDStripLightOutput::set_power_supply(PowerSupplyComponent *power_supply) {
+  this->power_supply_ = power_supply;
+}
+#endif
+int32_t ESP32RMTLEDStripLightOutput::size() const { return this->num_leds_; }
+ESPColorView ESP32RMTLEDStripLightOutput::operator[](int32_t index) const {
+  uint8_t *base = this->buffer_ + this->get_bytes_per_led_() * index;
+  return ESPColorView(base + this->rgb_offsets_[0], base + this->rgb_offsets_[1], base + this->rgb_offsets_[2],
+                      this->rgbw_ ? base + this->rgb_offsets_[3] : nullptr, this->effect_data_ + index,
+                      &this->get_write_correction_());
+}
+void ESP32RMTLEDStripLightOutput::clear_effect_data() {
+  for (int i = 0; i < this->size(); i++)
+    this->effect_data_[i] = 0;
+}
+bool ESP32RMTLEDStripLightOutput::get_raw_buffer_(ESPRawPixelBuffer *buffer) {
+  buffer->data = this->buffer_;
+  buffer->stride = this->get_bytes_per_led_();
+  buffer->offsets = this->rgb_offsets_;
+  return true;
+}
+uint8_t ESP32RMTLEDStripLightOutput::get_bytes_per_led_() const { return this->rgbw_ ? 4 : 3; }
+size_t ESP32RMTLEDStripLightOutput::get_buffer_size_() const {
+  return size_t(this->num_leds_) * this->get_bytes_per_led_();
+}
+LightTraits ESP32RMTLEDStripLightOutput::get_traits() { return {true, true, this->rgbw_, false}; }
+void ESP32RMTLEDStripLightOutput::setup() {
+  ESP_LOGCONFIG(TAG, "Setting up ESP32 RMT LED strip...");
+  const size_t len = this->get_buffer_size_();
+  this->buffer_ = new uint8_t[len];
+  this->tx_buffer_ = new uint8_t[len];
+  memset(this->buffer_, 0, len);
+  this->effect_data_ = new uint8_t[this->num_leds_];
+  this->clear_effect_data();
+
+  rmt_config_t c{};
+  c.rmt_mode = RMT_MODE_TX;
+  c.channel = this->channel_;
+  c.clk_div = RMT_CLOCK_DIVIDER;
+  c.gpio_num = gpio_num_t(this->pin_->get_pin());
+  c.mem_block_num = 1;
+  c.tx_config.loop_en = false;
+  c.tx_config.carrier_en = false;
+  c.tx_config.idle_output_en = true;
+  c.tx_config.idle_level = RMT_IDLE_LEVEL_LOW;
+
+  esp_err_t error = rmt_config(&c);
+#ifdef ESP32_RMT_LED_STRIP_TRANSLATOR
+  if (error == ESP_OK)
+    error = rmt_driver_install(this->channel_, 0, 0);
+  if (error == ESP_OK) {
+    switch (this->chipset_) {
+      case RMT_LED_SK6812:
+        error = rmt_translator_init(this->channel_, rmt_led_translate<RMT_LED_SK6812_BIT0, RMT_LED_SK6812_BIT1>);
+        break;
+      case RMT_LED_WS2811:
+        error = rmt_translator_init(this->channel_, rmt_led_translate<RMT_LED_WS2811_BIT0, RMT_LED_WS2811_BIT1>);
+        break;
+      case RMT_LED_WS2812:
+      default:
+        error = rmt_translator_init(this->channel_, rmt_led_translate<RMT_LED_WS2812_BIT0, RMT_LED_WS2812_BIT1>);
+        break;
+    }
+  }
+#else
+  switch (this->chipset_) {
+    case RMT_LED_SK6812:
+      this->bit0_ = RMT_LED_SK6812_BIT0;
+      this->bit1_ = RMT_LED_SK6812_BIT1;
+      break;
+    case RMT_LED_WS2811:
+      this->bit0_ = RMT_LED_WS2811_BIT0;
+      this->bit1_ = RMT_LED_WS2811_BIT1;
+      break;
+    case RMT_LED_WS2812:
+    default:
+      this->bit0_ = RMT_LED_WS2812_BIT0;
+      this->bit1_ = RMT_LED_WS2812_BIT1;
+      break;
+  }
+  if (error == ESP_OK && rmt_led_isr_handle == nullptr)
+    error = rmt_isr_register(rmt_isr_, nullptr, ESP_INTR_FLAG_IRAM, &rmt_led_isr_handle);
+  if (error == ESP_OK) {
+    // continue at the start of the channel memory after the last item
+    RMT.apb_conf.mem_tx_wrap_en = 1;
+    error = rmt_set_tx_thr_intr_en(this->channel_, true, RMT_LED_HALF_ITEMS);
+  }
+  if (error == ESP_OK)
+    error = rmt_set_tx_intr_en(this->channel_, true);
+  if (error == ESP_OK)
+    rmt_led_strips[this->channel_] = this;
+#endif
+  if (error != ESP_OK) {
+    this->error_code_ = error;
+    this->mark_failed();
+    return;
+  }
+}
+void ESP32RMTLEDStripLightOutput::dump_config() {
+  ESP_LOGCONFIG(TAG, "ESP32 RMT LED strip:");
+  LOG_PIN("  Pin: ", this->pin_);
+  ESP_LOGCONFIG(TAG, "  Channel: %d", this->channel_);
+  ESP_LOGCONFIG(TAG, "  Num LEDs: %u", this->num_leds_);
+  ESP_LOGCONFIG(TAG, "  RGBW: %s", YESNO(this->rgbw_));
+  ESP_LOGCONFIG(TAG, "  Dithering: %s", YESNO(this->is_dithering()));
+  ESP_LOGCONFIG(TAG, "  Wire time per frame: %u us", this->get_wire_time());
+  if (this->is_failed()) {
+    ESP_LOGE(TAG, "Configuring RMT driver failed: %s", esp_err_to_name(this->error_code_));
+    return;
+  }
+  ESP_LOGCONFIG(TAG, "  Frame time: %u us (max %u us)", this->frame_time_, this->max_frame_time_);
+  ESP_LOGCONFIG(TAG, "  Frames shown: %u, skipped (unchanged): %u", this->frames_shown_, this->frames_skipped_);
+}
+void ESP32RMTLEDStripLightOutput::loop() {
+  if (this->transmitting_) {
+    // previous frame is still being sent, try again in the next loop
+#ifdef ESP32_RMT_LED_STRIP_TRANSLATOR
+    if (rmt_wait_tx_done(this->channel_, 0) != ESP_OK)
+      return;
+#else
+    if (!this->tx_done_)
+      return;
+#endif
+    this->transmitting_ = false;
+    this->transmit_done_ = micros();
+    this->frame_time_ = this->transmit_done_ - this->transmit_start_;
+    this->max_frame_time_ = std::max(this->max_frame_time_, this->frame_time_);
+  }
+  if (micros() - this->transmit_done_ < RMT_LED_LATCH_TIME)
+    return;
+
+  if (!this->should_show_())
+    return;
+  this->mark_shown_();
+
+#ifdef USE_OUTPUT
+  if (this->power_supply_ != nullptr) {
+    bool is_on = false;
+    for (int i = 0; i < this->size(); i++) {
+      if ((*this)[i].get().is_on()) {
+        is_on = true;
+        break;
+      }
+    }
+
+    if (is_on && !this->has_requested_high_power_) {
+      this->power_supply_->request_high_power();
+      this->has_requested_high_power_ = true;
+    }
+    if (!is_on && this->has_requested_high_power_) {
+      this->power_supply_->unrequest_high_power();
+      this->has_requested_high_power_ = false;
+    }
+  }
+#endif
+
+  const size_t len = this->get_buffer_size_();
+  if (this->is_dithering()) {
+    this->render_dithered_(this->tx_buffer_);
+  } else {
+    memcpy(this->tx_buffer_, this->buffer_, len);
+  }
+  this->transmit_start_ = micros();
+#ifdef ESP32_RMT_LED_STRIP_TRANSLATOR
+  esp_err_t error = rmt_write_sample(this->channel_, this->tx_buffer_, len, false);
+#else
+  esp_err_t error = this->start_transmit_(len);
+#endif
+  if (error != ESP_OK) {
+    ESP_LOGW(TAG, "Starting RMT transfer failed: %s", esp_err_to_name(error));
+    return;
+  }
+  this->transmitting_ = true;
+}
+#ifndef ESP32_RMT_LED_STRIP_TRANSLATOR
+esp_err_t ESP32RMTLEDStripLightOutput::start_transmit_(size_t len) {
+  this->tx_len_ = len;
+  this->tx_pos_ = 0;
+  this->tx_half_ = 0;
+  this->tx_done_ = false;
+  this->fill_half_();
+  this->fill_half_();
+  RMT.int_clr.val = BIT(24 + this->channel_) | BIT(this->channel_ * 3);
+  return rmt_tx_start(this->channel_, true);
+}
+void IRAM_ATTR ESP32RMTLEDStripLightOutput::fill_half_() {
+  volatile uint32_t *dest = &RMTMEM.chan[this->channel_].data32[this->tx_half_ * RMT_LED_HALF_ITEMS].val;
+  for (uint8_t i = 0; i < RMT_LED_HALF_ITEMS / 8; i++) {
+    if (this->tx_pos_ >= this->tx_len_) {
+      // an item with zero duration ends the transfer
+      *dest = 0;
+      break;
+    }
+    const uint8_t byte = this->tx_buffer_[this->tx_pos_++];
+    for (uint8_t mask = 0x80; mask != 0; mask >>= 1)
+      *dest++ = (byte & mask) ? this->bit1_ : this->bit0_;
+  }
+  this->tx_half_ ^= 1;
+}
+void IRAM_ATTR ESP32RMTLEDStripLightOutput::rmt_isr_(void *arg) {
+  const uint32_t status = RMT.int_st.val;
+  for (uint8_t channel = 0; channel < RMT_CHANNEL_MAX; channel++) {
+    ESP32RMTLEDStripLightOutput *strip = rmt_led_strips[channel];
+    if (strip == nullptr)
+      continue;
+    // one half of the channel memory was sent, refill it while the other half is being sent
+    if (status & BIT(24 + channel))
+      strip->fill_half_();
+    if (status & BIT(channel * 3))
+      strip->tx_done_ = true;
+  }
+  RMT.int_clr.val = status;
+}
+#endif
+float ESP32RMTLEDStripLightOutput::get_setup_priority() const { return setup_priority::HARDWARE; }
+uint32_t ESP32RMTLEDStripLightOutput::get_frame_time() const { return this->frame_time_; }
+uint32_t ESP32RMTLEDStripLightOutput::get_max_frame_time() const { return this->max_frame_time_; }
+uint32_t ESP32RMTLEDStripLightOutput::get_wire_time() const {
+  uint32_t bit_time_ns;
+  switch (this->chipset_) {
+    case RMT_LED_SK6812:
+      bit_time_ns = 1200;
+      break;
+    case RMT_LED_WS2811:
+      bit_time_ns = 2500;
+      break;
+    case RMT_LED_WS2812:
+    default:
+      bit_time_ns = 1250;
+      break;
+  }
+  return this->get_buffer_size_() * 8 * bit_time_ns / 1000 + RMT_LED_LATCH_TIME;
+}
+
+}  // namespace light
+
+ESPHOME_NAMESPACE_END
+
+#endif  // USE_ESP32_RMT_LED_STRIP
@@ -0,0 +1,147 @@
+#ifndef ESPHOME_LIGHT_ESP32_RMT_LED_STRIP_H
+#define ESPHOME_LIGHT_ESP32_RMT_LED_STRIP_H
+
+#include "esphome/defines.h"
+
+#ifdef USE_ESP32_RMT_LED_STRIP
+
+#include <driver/rmt.h>
+#if defined(__has_include)
+#if __has_include(<esp_idf_version.h>)
+#include <esp_idf_version.h>
+#endif
+#endif
+#include "esphome/power_supply_component.h"
+#include "esphome/light/addressable_light.h"
+#include "esphome/esphal.h"
+
+// The RMT translator API (rmt_translator_init/rmt_write_sample) was added in ESP-IDF v3.3. With older versions
+// the strip uses its own RMT interrupt to convert the pixels while they are sent, see start_transmit_().
+#if defined(ESP_IDF_VERSION) && defined(ESP_IDF_VERSION_VAL)
+#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(3, 3, 0)
+#define ESP32_RMT_LED_STRIP_TRANSLATOR
+#endif
+#endif
+
+ESPHOME_NAMESPACE_BEGIN
+
+namespace light {
+
+/// The LED chip types supported by ESP32RMTLEDStripLightOutput.
+enum ESP32RMTLEDChipset {
+  RMT_LED_WS2812 = 0,
+  RMT_LED_SK6812,
+  RMT_LED_WS2811,
+};
+
+/// The order in which the color channels are sent to the LEDs.
+enum class ESP32RMTLEDOrder {
+  RGB = 0,
+  RBG,
+  GRB,
+  GBR,
+  BRG,
+  BGR,
+};
+
+/** Addressable light for a single-wire LED strip (WS2812 and similar) driven by an ESP32 RMT channel.
+ *
+ * loop() only starts the transfer of a frame and returns immediately, the RMT peripheral then sends it in the
+ * background while the pixels are converted to RMT pulses in its interrupt. Because of that, strips on different
+ * RMT channels (up to 8) are sent in parallel: with four strips of 300 LEDs each frame is on the wire after ~9 ms
+ * instead of ~36 ms when sending them one after another.
+ *
+ * The pixels are copied to a second buffer when a transfer starts, so effects can keep drawing while the
+ * frame is being sent. With dithering enabled, the corrected pixels are rendered into that buffer.
+ */
+class ESP32RMTLEDStripLightOutput : public Component, public AddressableLight {
+ public:
+  ESP32RMTLEDStripLightOutput(GPIOPin *pin, uint16_t num_leds, ESP32RMTLEDChipset chipset);
+
+  /// Manually set the RMT channel, by default the next free one is used.
+  void set_channel(rmt_channel_t channel);
+  void set_rgb_order(ESP32RMTLEDOrder order);
+  /// Whether the LEDs have a white channel (for example SK6812 RGBW), must be called before setup.
+  void set_rgbw(bool rgbw);
+#ifdef USE_OUTPUT
+  void set_power_supply(PowerSupplyComponent *power_supply);
+#endif
+
+  int32_t size() const override;
+  ESPColorView operator[](int32_t index) const override;
+  void clear_effect_data() override;
+
+  /// Get the time the last frame took from starting the transfer until it was seen as complete in µs.
+  uint32_t get_frame_time() const;
+  /// Get the longest frame time in µs.
+  uint32_t get_max_frame_time() const;
+  /// Get the time a frame needs on the wire in theory, in µs.
+  uint32_t get_wire_time() const;
+
+  // ========== INTERNAL METHODS ==========
+  // (In most use cases you won't need these)
+  LightTraits get_traits() override;
+  void setup() override;
+  void dump_config() override;
+  void loop() override;
+  float get_setup_priority() const override;
+
+ protected:
+  bool get_raw_buffer_(ESPRawPixelBuffer *buffer) override;
+  uint8_t get_bytes_per_led_() const;
+  size_t get_buffer_size_() const;
+#ifndef ESP32_RMT_LED_STRIP_TRANSLATOR
+  /** Start sending the first len bytes of tx_buffer_.
+   *
+   * The channel memory (64 items) is used as a ping-pong buffer: whenever one half of it was sent, the
+   * TX threshold interrupt converts the next 4 pixel bytes into that half. This interrupt replaces the one of
+   * the RMT driver, so with ESP-IDF < 3.3 the strip can't be combined with components that install the RMT
+   * driver (remote transmitter/receiver).
+   */
+  esp_err_t start_transmit_(size_t len);
+  /// Convert the next pixel bytes to RMT items in the next half of the channel memory.
+  void fill_half_();
+  static void rmt_isr_(void *arg);
+#endif
+
+  GPIOPin *pin_;
+  uint16_t num_leds_;
+  ESP32RMTLEDChipset chipset_;
+  rmt_channel_t channel_;
+  bool rgbw_{false};
+  uint8_t rgb_offsets_[4]{0, 1, 2, 3};
+  /// The pixels effects write to.
+  uint8_t *buffer_{nullptr};
+  /// The pixels of the frame that is being sent.
+  uint8_t *tx_buffer_{nullptr};
+#ifndef ESP32_RMT_LED_STRIP_TRANSLATOR
+  /// The RMT items for a 0 and a 1 bit.
+  uint32_t bit0_{0};
+  uint32_t bit1_{0};
+  size_t tx_len_{0};
+  /// The next byte of tx_buffer_ to convert, only changed by the interrupt during a transfer.
+  volatile size_t tx_pos_{0};
+  /// The half of the channel memory that is filled next.
+  volatile uint8_t tx_half_{0};
+  volatile bool tx_done_{true};
+#endif
+  uint8_t *effect_data_{nullptr};
+  bool transmitting_{false};
+  uint32_t transmit_start_{0};
+  uint32_t transmit_done_{0};
+  uint32_t frame_time_{0};
+  uint32_t max_frame_time_{0};
+  esp_err_t error_code_{ESP_OK};
+#ifdef USE_OUTPUT
+  PowerSupplyComponent *power_supply_{nullptr};
+  bool has_requested_high_power_{false};
+#endif
+};
+
+}  // namespace light
+
+ESPHOME_NAMESPACE_END
+
+#endif  // USE_ESP32_RMT_LED_STRIP
+
+#endif  // ESPHOME_LIGHT_ESP32_RMT_LED_STRIP_H
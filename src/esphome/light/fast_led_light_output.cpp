@@ -17,6 +17,12 @@ void FastLEDLightOutputComponent::setup() {
   this->controller_->init();
   this->controller_->setLeds(this->leds_, this->num_leds_);
   this->effect_data_ = new uint8_t[this->num_leds_];
+  if (this->is_dithering()) {
+    // effects write to an uncorrected copy, leds_ is calculated from it each time the LEDs are shown
+    this->dither_source_ = new CRGB[this->num_leds_];
+    for (int i = 0; i < this->num_leds_; i++)
+      this->dither_source_[i] = CRGB::Black;
+  }
   if (!this->max_refresh_rate_.has_value()) {
     this->set_max_refresh_rate(this->controller_->getMaxRefreshRate());
   }
@@ -25,6 +31,11 @@ void FastLEDLightOutputComponent::dump_config() {
   ESP_LOGCONFIG(TAG, "FastLED light:");
   ESP_LOGCONFIG(TAG, "  Num LEDs: %u", this->num_leds_);
   ESP_LOGCONFIG(TAG, "  Max refresh rate: %u", *this->max_refresh_rate_);
+  if (this->min_refresh_interval_ != 0) {
+    ESP_LOGCONFIG(TAG, "  Min refresh interval: %u ms", this->min_refresh_interval_);
+  }
+  ESP_LOGCONFIG(TAG, "  Dithering: %s", YESNO(this->is_dithering()));
+  ESP_LOGCONFIG(TAG, "  Frames shown: %u, skipped (unchanged): %u", this->frames_shown_, this->frames_skipped_);
 }
 void FastLEDLightOutputComponent::loop() {
   if (!this->should_show_())
@@ -39,6 +50,8 @@ void FastLEDLightOutputComponent::loop() {
   this->mark_shown_();
 
   ESP_LOGVV(TAG, "Writing RGB values to bus...");
+  if (this->dither_source_ != nullptr)
+    this->render_dithered_(reinterpret_cast<uint8_t *>(this->leds_));
 
 #ifdef USE_OUTPUT
   if (this->power_supply_ != nullptr) {
@@ -82,10 +95,20 @@ void FastLEDLightOutputComponent::set_power_supply(PowerSupplyComponent *power_s
 #endif
 
 ESPColorView FastLEDLightOutputComponent::operator[](int32_t index) const {
-  return ESPColorView(&this->leds_[index].r, &this->leds_[index].g, &this->leds_[index].b, nullptr,
-                      &this->effect_data_[index], &this->correction_);
+  CRGB *leds = this->dither_source_ != nullptr ? this->dither_source_ : this->leds_;
+  return ESPColorView(&leds[index].r, &leds[index].g, &leds[index].b, nullptr, &this->effect_data_[index],
+                      &this->get_write_correction_());
 }
 int32_t FastLEDLightOutputComponent::size() const { return this->num_leds_; }
+bool FastLEDLightOutputComponent::get_raw_buffer_(ESPRawPixelBuffer *buffer) {
+  // CRGB is always stored in RGB order, the controller re-orders the channels when sending
+  static const uint8_t OFFSETS[4] = {0, 1, 2, 3};
+  CRGB *leds = this->dither_source_ != nullptr ? this->dither_source_ : this->leds_;
+  buffer->data = reinterpret_cast<uint8_t *>(leds);
+  buffer->stride = sizeof(CRGB);
+  buffer->offsets = OFFSETS;
+  return true;
+}
 void FastLEDLightOutputComponent::clear_effect_data() {
   for (int i = 0; i < this->size(); i++)
     this->effect_data_[i] = 0;
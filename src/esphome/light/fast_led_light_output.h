@@ -369,14 +369,17 @@ class FastLEDLightOutputComponent : public Component, public AddressableLight {
   void clear_effect_data() override;
 
  protected:
+  bool get_raw_buffer_(ESPRawPixelBuffer *buffer) override;
+
   CLEDController *controller_{nullptr};
   CRGB *leds_{nullptr};
+  /// Uncorrected pixels when dithering is enabled.
+  CRGB *dither_source_{nullptr};
   uint8_t *effect_data_{nullptr};
   int num_leds_{0};
   uint32_t last_refresh_{0};
   optional<uint32_t> max_refresh_rate_{};
   bool prevent_writing_leds_{false};
-  bool next_show_{true};
 #ifdef USE_OUTPUT
   PowerSupplyComponent *power_supply_{nullptr};
   bool has_requested_high_power_{false};
@@ -21,6 +21,63 @@ namespace light {
 static const char *TAG = "light.light_color_values";
 #endif
 
+#ifdef USE_LIGHT_FIXED_POINT
+float LightColorValues::get_state() const { return this->state_ / 65535.0f; }
+
+void LightColorValues::set_state(float state) { this->state_ = float_to_q16(state); }
+void LightColorValues::set_state(bool state) { this->state_ = state ? 65535 : 0; }
+
+float LightColorValues::get_brightness() const { return this->brightness_ / 65535.0f; }
+
+void LightColorValues::set_brightness(float brightness) { this->brightness_ = float_to_q16(brightness); }
+
+float LightColorValues::get_red() const { return this->red_ / 65535.0f; }
+
+void LightColorValues::set_red(float red) { this->red_ = float_to_q16(red); }
+
+float LightColorValues::get_green() const { return this->green_ / 65535.0f; }
+
+void LightColorValues::set_green(float green) { this->green_ = float_to_q16(green); }
+
+float LightColorValues::get_blue() const { return this->blue_ / 65535.0f; }
+
+void LightColorValues::set_blue(float blue) { this->blue_ = float_to_q16(blue); }
+
+float LightColorValues::get_white() const { return this->white_ / 65535.0f; }
+
+void LightColorValues::set_white(float white) { this->white_ = float_to_q16(white); }
+
+LightColorValues::LightColorValues()
+    : state_(0), brightness_(65535), red_(65535), green_(65535), blue_(65535), white_(65535), color_temperature_{1.0f} {}
+
+LightColorValues LightColorValues::lerp(const LightColorValues &start, const LightColorValues &end, float completion) {
+  return lerp_q16(start, end, static_cast<uint32_t>(clamp(0.0f, 1.0f, completion) * 65536.0f + 0.5f));
+}
+
+static uint16_t lerp_q16_value(uint16_t start, uint16_t end, int32_t half_completion) {
+  // half_completion is at most 32768, so the product always fits in 32 bits
+  return start + (((int32_t(end) - int32_t(start)) * half_completion + 16384) >> 15);
+}
+LightColorValues LightColorValues::lerp_q16(const LightColorValues &start, const LightColorValues &end,
+                                            uint32_t completion) {
+  const int32_t half = std::min(completion, uint32_t(65536)) >> 1;
+  LightColorValues v;
+  v.state_ = lerp_q16_value(start.state_, end.state_, half);
+  v.brightness_ = lerp_q16_value(start.brightness_, end.brightness_, half);
+  v.red_ = lerp_q16_value(start.red_, end.red_, half);
+  v.green_ = lerp_q16_value(start.green_, end.green_, half);
+  v.blue_ = lerp_q16_value(start.blue_, end.blue_, half);
+  v.white_ = lerp_q16_value(start.white_, end.white_, half);
+  if (start.color_temperature_ != end.color_temperature_) {
+    v.set_color_temperature(
+        esphome::lerp(start.get_color_temperature(), end.get_color_temperature(), half / 32768.0f));
+  } else {
+    v.color_temperature_ = start.color_temperature_;
+  }
+
+  return v;
+}
+#else
 float LightColorValues::get_state() const { return this->state_; }
 
 void LightColorValues::set_state(float state) { this->state_ = clamp(0.0f, 1.0f, state); }
@@ -62,6 +119,8 @@ LightColorValues LightColorValues::lerp(const LightColorValues &start, const Lig
   return v;
 }
 
+#endif
+
 LightColorValues::LightColorValues(float state, float brightness, float red, float green, float blue, float white,
                                    float color_temperature) {
   this->set_state(state);
@@ -134,6 +193,87 @@ bool LightColorValues::operator==(const LightColorValues &rhs) const {
 }
 
 bool LightColorValues::operator!=(const LightColorValues &rhs) const { return !(rhs == *this); }
+#ifdef USE_LIGHT_FIXED_POINT
+void LightColorValues::as_rgbw(float *red, float *green, float *blue, float *white) const {
+  uint16_t r, g, b, w;
+  this->as_rgbw_q16(&r, &g, &b, &w);
+  *red = r / 65535.0f;
+  *green = g / 65535.0f;
+  *blue = b / 65535.0f;
+  *white = w / 65535.0f;
+}
+void LightColorValues::as_rgbww(float color_temperature_cw, float color_temperature_ww, float *red, float *green,
+                                float *blue, float *cold_white, float *warm_white) const {
+  uint16_t r, g, b, cw, ww;
+  this->as_rgbww_q16(color_temperature_cw, color_temperature_ww, &r, &g, &b, &cw, &ww);
+  *red = r / 65535.0f;
+  *green = g / 65535.0f;
+  *blue = b / 65535.0f;
+  *cold_white = cw / 65535.0f;
+  *warm_white = ww / 65535.0f;
+}
+void LightColorValues::as_cwww(float color_temperature_cw, float color_temperature_ww, float *cold_white,
+                               float *warm_white) const {
+  uint16_t cw, ww;
+  this->as_cwww_q16(color_temperature_cw, color_temperature_ww, &cw, &ww);
+  *cold_white = cw / 65535.0f;
+  *warm_white = ww / 65535.0f;
+}
+void LightColorValues::as_rgb(float *red, float *green, float *blue) const {
+  uint16_t r, g, b;
+  this->as_rgb_q16(&r, &g, &b);
+  *red = r / 65535.0f;
+  *green = g / 65535.0f;
+  *blue = b / 65535.0f;
+}
+void LightColorValues::as_brightness(float *brightness) const {
+  uint16_t value;
+  this->as_brightness_q16(&value);
+  *brightness = value / 65535.0f;
+}
+void LightColorValues::as_binary(bool *binary) const { *binary = this->state_ == 65535; }
+
+void LightColorValues::cwww_fractions_q16_(float color_temperature_cw, float color_temperature_ww,
+                                           uint16_t *cold_white, uint16_t *warm_white) const {
+  const float color_temp = clamp(color_temperature_cw, color_temperature_ww, this->color_temperature_);
+  const float ww_fraction = (color_temp - color_temperature_cw) / (color_temperature_ww - color_temperature_cw);
+  const float cw_fraction = 1.0f - ww_fraction;
+  const float max_cw_ww = std::max(ww_fraction, cw_fraction);
+  *cold_white = float_to_q16(cw_fraction / max_cw_ww);
+  *warm_white = float_to_q16(ww_fraction / max_cw_ww);
+}
+void LightColorValues::as_brightness_q16(uint16_t *brightness) const {
+  *brightness = q16_mul(this->state_, this->brightness_);
+}
+void LightColorValues::as_rgb_q16(uint16_t *red, uint16_t *green, uint16_t *blue) const {
+  const uint16_t brightness = q16_mul(this->state_, this->brightness_);
+  *red = q16_mul(brightness, this->red_);
+  *green = q16_mul(brightness, this->green_);
+  *blue = q16_mul(brightness, this->blue_);
+}
+void LightColorValues::as_rgbw_q16(uint16_t *red, uint16_t *green, uint16_t *blue, uint16_t *white) const {
+  this->as_rgb_q16(red, green, blue);
+  *white = q16_mul(this->state_, this->white_);
+}
+void LightColorValues::as_rgbww_q16(float color_temperature_cw, float color_temperature_ww, uint16_t *red,
+                                    uint16_t *green, uint16_t *blue, uint16_t *cold_white,
+                                    uint16_t *warm_white) const {
+  this->as_rgb_q16(red, green, blue);
+  uint16_t cw_fraction, ww_fraction;
+  this->cwww_fractions_q16_(color_temperature_cw, color_temperature_ww, &cw_fraction, &ww_fraction);
+  const uint16_t white = q16_mul(this->state_, this->white_);
+  *cold_white = q16_mul(white, cw_fraction);
+  *warm_white = q16_mul(white, ww_fraction);
+}
+void LightColorValues::as_cwww_q16(float color_temperature_cw, float color_temperature_ww, uint16_t *cold_white,
+                                   uint16_t *warm_white) const {
+  uint16_t cw_fraction, ww_fraction;
+  this->cwww_fractions_q16_(color_temperature_cw, color_temperature_ww, &cw_fraction, &ww_fraction);
+  const uint16_t brightness = q16_mul(this->state_, this->brightness_);
+  *cold_white = q16_mul(brightness, cw_fraction);
+  *warm_white = q16_mul(brightness, ww_fraction);
+}
+#else
 void LightColorValues::as_rgbw(float *red, float *green, float *blue, float *white) const {
   this->as_rgb(red, green, blue);
   *white = this->state_ * this->white_;
@@ -165,6 +305,7 @@ void LightColorValues::as_rgb(float *red, float *green, float *blue) const {
 }
 void LightColorValues::as_brightness(float *brightness) const { *brightness = this->state_ * this->brightness_; }
 void LightColorValues::as_binary(bool *binary) const { *binary = this->state_ == 1.0f; }
+#endif
 LightColorValues LightColorValues::from_binary(bool state) { return {state, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f}; }
 LightColorValues LightColorValues::from_monochromatic(float brightness) {
   if (brightness == 0.0f)
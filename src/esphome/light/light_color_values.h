@@ -21,6 +21,10 @@ namespace light {
  *
  * PLease note all float values are automatically clamped.
  *
+ * If USE_LIGHT_FIXED_POINT is defined, the values (except the color temperature) are stored as 16-bit fixed point
+ * numbers (0 = 0.0, 65535 = 1.0) instead, and transitions and conversions are calculated without floating point
+ * math, which is a lot faster on chips without FPU like the ESP8266. The float interface stays the same.
+ *
  * state - Whether the light should be on/off. Represented as a float for transitions.
  * brightness - The brightness of the light.
  * red, green, blue - RGB values.
@@ -61,6 +65,11 @@ class LightColorValues {
    */
   static LightColorValues lerp(const LightColorValues &start, const LightColorValues &end, float completion);
 
+#ifdef USE_LIGHT_FIXED_POINT
+  /// Same as lerp(), but with completion as a fixed point number from 0 (start) to 65536 (end).
+  static LightColorValues lerp_q16(const LightColorValues &start, const LightColorValues &end, uint32_t completion);
+#endif
+
   /** Dump this color into a JsonObject. Only dumps values if the corresponding traits are marked supported by traits.
    *
    * @param root The json root object.
@@ -96,6 +105,25 @@ class LightColorValues {
   /// Convert these light color values to an CWWW representation with the given parameters.
   void as_cwww(float color_temperature_cw, float color_temperature_ww, float *cold_white, float *warm_white) const;
 
+#ifdef USE_LIGHT_FIXED_POINT
+  /// Fixed point versions of the conversions above, all values are in range 0 to 65535.
+  void as_brightness_q16(uint16_t *brightness) const;
+  void as_rgb_q16(uint16_t *red, uint16_t *green, uint16_t *blue) const;
+  void as_rgbw_q16(uint16_t *red, uint16_t *green, uint16_t *blue, uint16_t *white) const;
+  void as_rgbww_q16(float color_temperature_cw, float color_temperature_ww, uint16_t *red, uint16_t *green,
+                    uint16_t *blue, uint16_t *cold_white, uint16_t *warm_white) const;
+  void as_cwww_q16(float color_temperature_cw, float color_temperature_ww, uint16_t *cold_white,
+                   uint16_t *warm_white) const;
+
+  /// Get the raw fixed point values, in range 0 to 65535.
+  uint16_t get_state_q16() const { return this->state_; }
+  uint16_t get_brightness_q16() const { return this->brightness_; }
+  uint16_t get_red_q16() const { return this->red_; }
+  uint16_t get_green_q16() const { return this->green_; }
+  uint16_t get_blue_q16() const { return this->blue_; }
+  uint16_t get_white_q16() const { return this->white_; }
+#endif
+
   /// Compare this LightColorValues to rhs, return true if and only if all attributes match.
   bool operator==(const LightColorValues &rhs) const;
   bool operator!=(const LightColorValues &rhs) const;
@@ -140,12 +168,25 @@ class LightColorValues {
   void set_color_temperature(float color_temperature);
 
  protected:
+#ifdef USE_LIGHT_FIXED_POINT
+  /// Calculate the cold white and warm white fractions (0 to 65535) for the color temperature.
+  void cwww_fractions_q16_(float color_temperature_cw, float color_temperature_ww, uint16_t *cold_white,
+                           uint16_t *warm_white) const;
+
+  uint16_t state_;  ///< ON / OFF, not binary for transition
+  uint16_t brightness_;
+  uint16_t red_;
+  uint16_t green_;
+  uint16_t blue_;
+  uint16_t white_;
+#else
   float state_;  ///< ON / OFF, float for transition
   float brightness_;
   float red_;
   float green_;
   float blue_;
   float white_;
+#endif
   float color_temperature_;  ///< Color Temperature in Mired
 };
 
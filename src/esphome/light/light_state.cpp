@@ -62,9 +62,53 @@ void LightState::start_effect_(uint32_t effect_index) {
     return;
 
   this->active_effect_index_ = effect_index;
+  this->next_effect_frame_ = micros();
+  // a fixed frame rate above the main loop rate (~60Hz) needs the loop to run continuously
+  if (this->effect_frame_interval_ != 0)
+    this->effect_high_freq_.start();
   auto *effect = this->get_active_effect_();
   effect->start_internal();
 }
+bool LightState::should_render_effect_() {
+  if (this->effect_frame_interval_ == 0)
+    return true;
+
+  const uint32_t now = micros();
+  const int32_t late = now - this->next_effect_frame_;
+  if (late < 0)
+    return false;
+
+  // schedule on the fixed frame grid, so the effect keeps its speed even if the main loop is late
+  const uint32_t missed = uint32_t(late) / this->effect_frame_interval_;
+  const uint32_t jitter = uint32_t(late) - missed * this->effect_frame_interval_;
+  this->effect_stats_.dropped += missed;
+  if (jitter > this->effect_stats_.max_jitter)
+    this->effect_stats_.max_jitter = jitter;
+  this->next_effect_frame_ += (missed + 1) * this->effect_frame_interval_;
+  return true;
+}
+void LightState::set_effect_fps(uint16_t effect_fps) {
+  this->effect_frame_interval_ = effect_fps == 0 ? 0 : 1000000UL / effect_fps;
+  if (this->get_active_effect_() == nullptr)
+    return;
+  if (this->effect_frame_interval_ != 0)
+    this->effect_high_freq_.start();
+  else
+    this->effect_high_freq_.stop();
+}
+uint16_t LightState::get_effect_fps() const {
+  if (this->effect_frame_interval_ == 0)
+    return 0;
+  return 1000000UL / this->effect_frame_interval_;
+}
+LightEffectStats LightState::get_effect_stats(bool reset) {
+  LightEffectStats stats = this->effect_stats_;
+  if (reset) {
+    this->effect_stats_ = LightEffectStats{};
+    this->effect_stats_.since = millis();
+  }
+  return stats;
+}
 
 bool LightState::supports_effects() { return !this->effects_.empty(); }
 void LightState::set_transformer_(std::unique_ptr<LightTransformer> transformer) {
@@ -75,6 +119,7 @@ void LightState::stop_effect_() {
   if (effect != nullptr) {
     effect->stop();
   }
+  this->effect_high_freq_.stop();
   this->active_effect_index_ = 0;
 }
 
@@ -129,8 +174,15 @@ void LightState::setup() {
 void LightState::loop() {
   // Apply effect (if any)
   auto *effect = this->get_active_effect_();
-  if (effect != nullptr) {
+  if (effect != nullptr && this->should_render_effect_()) {
+    const uint32_t start = micros();
     effect->apply();
+    const uint32_t render_time = micros() - start;
+    this->effect_stats_.frames++;
+    if (render_time > this->effect_stats_.max_render_time)
+      this->effect_stats_.max_render_time = render_time;
+    if (this->effect_frame_interval_ != 0 && render_time > this->effect_frame_interval_)
+      this->effect_stats_.overruns++;
   }
 
   // Apply transformer (if any)
@@ -175,6 +227,9 @@ void LightState::dump_config() {
     ESP_LOGCONFIG(TAG, "  Min Mireds: %.1f", this->get_traits().get_min_mireds());
     ESP_LOGCONFIG(TAG, "  Max Mireds: %.1f", this->get_traits().get_max_mireds());
   }
+  if (this->supports_effects() && this->effect_frame_interval_ != 0) {
+    ESP_LOGCONFIG(TAG, "  Effect Frame Rate: %u FPS", this->get_effect_fps());
+  }
 }
 #ifdef USE_MQTT_LIGHT
 MQTTJSONLightComponent *LightState::get_mqtt() const { return this->mqtt_; }
@@ -661,8 +716,70 @@ LightCall &LightCall::set_rgbw(float red, float green, float blue, float white)
 
 float LightState::get_setup_priority() const { return setup_priority::HARDWARE - 1.0f; }
 LightOutput *LightState::get_output() const { return this->output_; }
-void LightState::set_gamma_correct(float gamma_correct) { this->gamma_correct_ = gamma_correct; }
+void LightState::set_gamma_correct(float gamma_correct) {
+  this->gamma_correct_ = gamma_correct;
+#ifdef USE_LIGHT_FIXED_POINT
+  delete[] this->gamma_table_;
+  this->gamma_table_ = nullptr;
+#endif
+}
 void LightState::current_values_as_binary(bool *binary) { this->current_values.as_binary(binary); }
+#ifdef USE_LIGHT_FIXED_POINT
+float HOT LightState::gamma_correct_q16_(uint16_t value) {
+  if (this->gamma_table_ == nullptr) {
+    this->gamma_table_ = new uint16_t[257];
+    for (uint16_t i = 0; i <= 256; i++)
+      this->gamma_table_[i] = float_to_q16(gamma_correct(i / 256.0f, this->gamma_correct_));
+  }
+  // scale 0-65535 to 0-65536 so that the upper 8 bits are the table index
+  const uint32_t pos = value + (value >> 15);
+  const uint16_t index = pos >> 8;
+  const uint16_t frac = pos & 0xFF;
+  uint32_t corrected = this->gamma_table_[index];
+  if (frac != 0) {
+    const uint32_t next = this->gamma_table_[index + 1];
+    corrected += ((next - corrected) * frac + 128) >> 8;
+  }
+  return corrected / 65535.0f;
+}
+void LightState::current_values_as_brightness(float *brightness) {
+  uint16_t value;
+  this->current_values.as_brightness_q16(&value);
+  *brightness = this->gamma_correct_q16_(value);
+}
+void LightState::current_values_as_rgb(float *red, float *green, float *blue) {
+  uint16_t r, g, b;
+  this->current_values.as_rgb_q16(&r, &g, &b);
+  *red = this->gamma_correct_q16_(r);
+  *green = this->gamma_correct_q16_(g);
+  *blue = this->gamma_correct_q16_(b);
+}
+void LightState::current_values_as_rgbw(float *red, float *green, float *blue, float *white) {
+  uint16_t r, g, b, w;
+  this->current_values.as_rgbw_q16(&r, &g, &b, &w);
+  *red = this->gamma_correct_q16_(r);
+  *green = this->gamma_correct_q16_(g);
+  *blue = this->gamma_correct_q16_(b);
+  *white = this->gamma_correct_q16_(w);
+}
+void LightState::current_values_as_rgbww(float color_temperature_cw, float color_temperature_ww, float *red,
+                                         float *green, float *blue, float *cold_white, float *warm_white) {
+  uint16_t r, g, b, cw, ww;
+  this->current_values.as_rgbww_q16(color_temperature_cw, color_temperature_ww, &r, &g, &b, &cw, &ww);
+  *red = this->gamma_correct_q16_(r);
+  *green = this->gamma_correct_q16_(g);
+  *blue = this->gamma_correct_q16_(b);
+  *cold_white = this->gamma_correct_q16_(cw);
+  *warm_white = this->gamma_correct_q16_(ww);
+}
+void LightState::current_values_as_cwww(float color_temperature_cw, float color_temperature_ww, float *cold_white,
+                                        float *warm_white) {
+  uint16_t cw, ww;
+  this->current_values.as_cwww_q16(color_temperature_cw, color_temperature_ww, &cw, &ww);
+  *cold_white = this->gamma_correct_q16_(cw);
+  *warm_white = this->gamma_correct_q16_(ww);
+}
+#else
 void LightState::current_values_as_brightness(float *brightness) {
   this->current_values.as_brightness(brightness);
   *brightness = gamma_correct(*brightness, this->gamma_correct_);
@@ -695,6 +812,7 @@ void LightState::current_values_as_cwww(float color_temperature_cw, float color_
   *cold_white = gamma_correct(*cold_white, this->gamma_correct_);
   *warm_white = gamma_correct(*warm_white, this->gamma_correct_);
 }
+#endif
 void LightState::add_new_remote_values_callback(light_send_callback_t &&send_callback) {
   this->remote_values_callback_.add(std::move(send_callback));
 }
@@ -173,6 +173,16 @@ class LightCall {
   bool save_{true};
 };
 
+/// Statistics of the effect renderer of a LightState.
+struct LightEffectStats {
+  uint32_t frames;           ///< Number of rendered frames.
+  uint32_t dropped;          ///< Number of frames that were skipped because the main loop was too late.
+  uint32_t overruns;         ///< Number of frames that took longer to render than the frame interval.
+  uint32_t max_render_time;  ///< Longest render time of a frame in µs.
+  uint32_t max_jitter;       ///< Largest delay of a frame after its scheduled time in µs.
+  uint32_t since;            ///< millis() timestamp of when these statistics were last reset.
+};
+
 /** This class represents the communication layer between the front-end MQTT layer and the
  * hardware output layer.
  */
@@ -265,6 +275,18 @@ class LightState : public Nameable, public Component {
 
   void add_effects(std::vector<LightEffect *> effects);
 
+  /** Set the frame rate at which the active effect should be rendered.
+   *
+   * By default (0) effects are applied in every loop() iteration, so how often they are rendered depends on
+   * how busy the main loop is. With a target frame rate, frames are scheduled at fixed points in time
+   * and frames the main loop was too late for are dropped instead of being rendered in a burst. The main loop
+   * runs continuously while such an effect is active, so that frame rates above its default rate are reached.
+   */
+  void set_effect_fps(uint16_t effect_fps);
+  uint16_t get_effect_fps() const;
+  /// Get the statistics of the effect renderer, optionally resetting them.
+  LightEffectStats get_effect_stats(bool reset = false);
+
 #ifdef USE_MQTT_LIGHT
   MQTTJSONLightComponent *get_mqtt() const;
   void set_mqtt(MQTTJSONLightComponent *mqtt);
@@ -308,6 +330,14 @@ class LightState : public Nameable, public Component {
 
   LightEffect *get_active_effect_();
 
+  /// Internal method to check if the next effect frame is due, updates the renderer statistics.
+  bool should_render_effect_();
+
+#ifdef USE_LIGHT_FIXED_POINT
+  /// Apply gamma correction to a fixed point value with a lookup table instead of powf().
+  float gamma_correct_q16_(uint16_t value);
+#endif
+
   /// Object used to store the persisted values of the light.
   ESPPreferenceObject rtc_;
   /// Default transition length for all transitions in ms.
@@ -329,8 +359,19 @@ class LightState : public Nameable, public Component {
   bool next_write_{true};
   /// Gamma correction factor for the light.
   float gamma_correct_{2.8f};
+#ifdef USE_LIGHT_FIXED_POINT
+  /// Gamma corrected values for 0/256 to 256/256, calculated on first use.
+  uint16_t *gamma_table_{nullptr};
+#endif
   /// List of effects for this light.
   std::vector<LightEffect *> effects_;
+  /// Time between two effect frames in µs, 0 to render in every loop() iteration.
+  uint32_t effect_frame_interval_{0};
+  /// micros() timestamp of when the next effect frame is due.
+  uint32_t next_effect_frame_{0};
+  /// Keeps the main loop running continuously while an effect with a fixed frame rate is active.
+  HighFrequencyLoopRequester effect_high_freq_;
+  LightEffectStats effect_stats_{};
 #ifdef USE_MQTT_LIGHT
   MQTTJSONLightComponent *mqtt_{nullptr};
 #endif
@@ -21,7 +21,24 @@ LightTransformer::LightTransformer(uint32_t start_time, uint32_t length, const L
                                    const LightColorValues &target_values)
     : start_time_(start_time), length_(length), start_values_(start_values), target_values_(target_values) {}
 
+#ifdef USE_LIGHT_FIXED_POINT
+bool LightTransformer::is_finished() { return this->get_progress_q16_() >= 65536; }
+
+uint32_t LightTransformer::get_progress_q16_() {
+  uint32_t elapsed = millis() - this->start_time_;
+  uint32_t length = this->length_;
+  if (elapsed >= length)
+    return 65536;
+  // keep elapsed << 16 in 32 bits, long transitions have more than enough steps anyway
+  while (length > 0xFFFF) {
+    length >>= 1;
+    elapsed >>= 1;
+  }
+  return (elapsed << 16) / length;
+}
+#else
 bool LightTransformer::is_finished() { return this->get_progress_() >= 1.0f; }
+#endif
 
 float LightTransformer::get_progress_() {
   return clamp(0.0f, 1.0f, (millis() - this->start_time_) / float(this->length_));
@@ -32,9 +49,20 @@ LightColorValues LightTransformer::get_remote_values() { return this->get_target
 LightColorValues LightTransformer::get_end_values() { return this->get_target_values_(); }
 
 LightColorValues LightTransitionTransformer::get_values() {
+#ifdef USE_LIGHT_FIXED_POINT
+  // same curve as below, with x and v from 0 to 65536
+  const int64_t x = this->get_progress_q16_();
+  int64_t v = (x * (x * 6 - 15 * 65536)) >> 16;
+  v = ((v + 10 * 65536) * x) >> 16;
+  v = (v * x) >> 16;
+  v = (v * x) >> 16;
+  const uint32_t completion = clamp<int64_t>(0, 65536, v);
+  return LightColorValues::lerp_q16(this->get_start_values_(), this->get_target_values_(), completion);
+#else
   float x = this->get_progress_();
   float v = x * x * x * (x * (x * 6.0f - 15.0f) + 10.0f);
   return LightColorValues::lerp(this->get_start_values_(), this->get_target_values_(), v);
+#endif
 }
 LightTransitionTransformer::LightTransitionTransformer(uint32_t start_time, uint32_t length,
                                                        const LightColorValues &start_values,
@@ -36,6 +36,10 @@ class LightTransformer {
  protected:
   /// Get the completion of this transformer, 0 to 1.
   float get_progress_();
+#ifdef USE_LIGHT_FIXED_POINT
+  /// Get the completion of this transformer as a fixed point number, 0 to 65536.
+  uint32_t get_progress_q16_();
+#endif
 
   const LightColorValues &get_start_values_() const;
 
@@ -92,8 +92,14 @@ class NeoPixelBusLightOutputBase : public Component, public AddressableLight {
   void set_pixel_order(ESPNeoPixelOrder order);
 
  protected:
+  bool get_raw_buffer_(ESPRawPixelBuffer *buffer) override;
+  /// The pixels effects write to, the uncorrected copy if dithering is enabled.
+  uint8_t *get_pixels_() const;
+
   NeoPixelBus<T_COLOR_FEATURE, T_METHOD> *controller_{nullptr};
   uint8_t *effect_data_{nullptr};
+  /// Uncorrected pixels when dithering is enabled.
+  uint8_t *dither_source_{nullptr};
   uint8_t rgb_offsets_[4]{0, 1, 2, 3};
 #ifdef USE_OUTPUT
   PowerSupplyComponent *power_supply_{nullptr};
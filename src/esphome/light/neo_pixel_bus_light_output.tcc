@@ -50,21 +50,33 @@ void NeoPixelBusLightOutputBase<T_METHOD, T_COLOR_FEATURE>::add_leds(
 }
 template<typename T_METHOD, typename T_COLOR_FEATURE>
 void NeoPixelBusLightOutputBase<T_METHOD, T_COLOR_FEATURE>::setup() {
-  for (int i = 0; i < this->size(); i++) {
-    (*this)[i] = ESPColor(0, 0, 0, 0);
+  if (this->is_dithering()) {
+    // effects write to an uncorrected copy, the controller's pixels are calculated from it when showing
+    this->dither_source_ = new uint8_t[this->size() * T_COLOR_FEATURE::PixelSize];
   }
+  this->fill(ESPColor(0, 0, 0, 0));
 
   this->effect_data_ = new uint8_t[this->size()];
   this->controller_->Begin();
 }
 template<typename T_METHOD, typename T_COLOR_FEATURE>
-void NeoPixelBusLightOutputBase<T_METHOD, T_COLOR_FEATURE>::dump_config() {}
+void NeoPixelBusLightOutputBase<T_METHOD, T_COLOR_FEATURE>::dump_config() {
+  ESP_LOGCONFIG(TAG, "NeoPixelBus light:");
+  ESP_LOGCONFIG(TAG, "  Num LEDs: %d", this->size());
+  if (this->min_refresh_interval_ != 0) {
+    ESP_LOGCONFIG(TAG, "  Min refresh interval: %u ms", this->min_refresh_interval_);
+  }
+  ESP_LOGCONFIG(TAG, "  Dithering: %s", YESNO(this->is_dithering()));
+  ESP_LOGCONFIG(TAG, "  Frames shown: %u, skipped (unchanged): %u", this->frames_shown_, this->frames_skipped_);
+}
 template<typename T_METHOD, typename T_COLOR_FEATURE>
 void NeoPixelBusLightOutputBase<T_METHOD, T_COLOR_FEATURE>::loop() {
   if (!this->should_show_())
     return;
 
   this->mark_shown_();
+  if (this->dither_source_ != nullptr)
+    this->render_dithered_(this->controller_->Pixels());
   this->controller_->Dirty();
 
 #ifdef USE_OUTPUT
@@ -99,6 +111,21 @@ int32_t NeoPixelBusLightOutputBase<T_METHOD, T_COLOR_FEATURE>::size() const {
   return this->controller_->PixelCount();
 }
 
+template<typename T_METHOD, typename T_COLOR_FEATURE>
+bool NeoPixelBusLightOutputBase<T_METHOD, T_COLOR_FEATURE>::get_raw_buffer_(ESPRawPixelBuffer *buffer) {
+  buffer->data = this->get_pixels_();
+  buffer->stride = T_COLOR_FEATURE::PixelSize;
+  buffer->offsets = this->rgb_offsets_;
+  return true;
+}
+
+template<typename T_METHOD, typename T_COLOR_FEATURE>
+uint8_t *NeoPixelBusLightOutputBase<T_METHOD, T_COLOR_FEATURE>::get_pixels_() const {
+  if (this->dither_source_ != nullptr)
+    return this->dither_source_;
+  return this->controller_->Pixels();
+}
+
 template<typename T_METHOD, typename T_COLOR_FEATURE>
 void NeoPixelBusLightOutputBase<T_METHOD, T_COLOR_FEATURE>::set_pixel_order(ESPNeoPixelOrder order) {
   uint8_t u_order = static_cast<uint8_t>(order);
@@ -110,16 +137,16 @@ void NeoPixelBusLightOutputBase<T_METHOD, T_COLOR_FEATURE>::set_pixel_order(ESPN
 
 template<typename T_METHOD, typename T_COLOR_FEATURE>
 ESPColorView NeoPixelRGBLightOutput<T_METHOD, T_COLOR_FEATURE>::operator[](int32_t index) const {
-  uint8_t *base = this->controller_->Pixels() + 3ULL * index;
+  uint8_t *base = this->get_pixels_() + 3ULL * index;
   return ESPColorView(base + this->rgb_offsets_[0], base + this->rgb_offsets_[1], base + this->rgb_offsets_[2], nullptr,
-                      this->effect_data_ + index, &this->correction_);
+                      this->effect_data_ + index, &this->get_write_correction_());
 }
 
 template<typename T_METHOD, typename T_COLOR_FEATURE>
 ESPColorView NeoPixelRGBWLightOutput<T_METHOD, T_COLOR_FEATURE>::operator[](int32_t index) const {
-  uint8_t *base = this->controller_->Pixels() + 4ULL * index;
+  uint8_t *base = this->get_pixels_() + 4ULL * index;
   return ESPColorView(base + this->rgb_offsets_[0], base + this->rgb_offsets_[1], base + this->rgb_offsets_[2],
-                      base + this->rgb_offsets_[3], this->effect_data_ + index, &this->correction_);
+                      base + this->rgb_offsets_[3], this->effect_data_ + index, &this->get_write_correction_());
 }
 
 template<typename T_METHOD, typename T_COLOR_FEATURE>
@@ -75,6 +75,13 @@ void MQTTClientComponent::dump_config() {
   if (!this->availability_.topic.empty()) {
     ESP_LOGCONFIG(TAG, "  Availability: '%s'", this->availability_.topic.c_str());
   }
+  if (this->offline_buffer_size_ != 0) {
+    ESP_LOGCONFIG(TAG, "  Offline Buffer: %u messages (%u/loop)", this->offline_buffer_size_,
+                  this->offline_replay_rate_);
+    if (this->offline_max_age_ != 0) {
+      ESP_LOGCONFIG(TAG, "  Offline Buffer Max Age: %u ms", this->offline_max_age_);
+    }
+  }
 }
 bool MQTTClientComponent::can_proceed() { return this->is_connected(); }
 
@@ -285,6 +292,7 @@ void MQTTClientComponent::loop() {
 
         this->last_connected_ = now;
         this->resubscribe_subscriptions_();
+        this->replay_offline_buffer_();
       }
       break;
   }
@@ -398,6 +406,79 @@ bool MQTTClientComponent::publish_json(const std::string &topic, const json_buil
   return this->publish(topic, message, len, qos, retain);
 }
 
+bool MQTTClientComponent::buffer_message(const std::string &topic, const char *payload, size_t payload_length,
+                                         uint8_t qos, bool retain) {
+  if (this->offline_buffer_size_ == 0)
+    return false;
+
+  while (this->offline_buffer_.size() >= this->offline_buffer_size_) {
+    this->offline_buffer_.pop_front();
+    this->offline_dropped_++;
+  }
+  this->offline_buffer_.push_back(MQTTBufferedMessage{
+      .message =
+          MQTTMessage{
+              .topic = topic,
+              .payload = std::string(payload, payload_length),
+              .qos = qos,
+              .retain = retain,
+          },
+      .timestamp = millis(),
+  });
+  ESP_LOGVV(TAG, "Buffered message for topic='%s' (%u in buffer)", topic.c_str(), this->offline_buffer_.size());
+  return true;
+}
+void MQTTClientComponent::replay_offline_buffer_() {
+  if (this->offline_buffer_.empty())
+    return;
+
+  const uint32_t now = millis();
+  uint16_t sent = 0;
+  while (!this->offline_buffer_.empty() && sent < this->offline_replay_rate_) {
+    const MQTTBufferedMessage &front = this->offline_buffer_.front();
+    if (this->offline_max_age_ != 0 && now - front.timestamp > this->offline_max_age_) {
+      this->offline_buffer_.pop_front();
+      this->offline_dropped_++;
+      continue;
+    }
+    // Publish the captured state together with its age to a companion topic, the state topic itself receives the
+    // latest state once the replay has finished.
+    const uint32_t age = now - front.timestamp;
+    const std::string &payload = front.message.payload;
+    auto f = [&payload, age](JsonObject &root) {
+      if (!payload.empty() && (payload[0] == '{' || payload[0] == '['))
+        // JSON states (lights, covers, ...) are embedded as they are instead of being encoded as a string
+        root["state"] = RawJson(payload.c_str());
+      else
+        root["state"] = payload.c_str();
+      root["age"] = age;
+    };
+    bool success = this->publish_json(front.message.topic + "/history", f, front.message.qos, front.message.retain);
+    if (!success)
+      // try again next loop
+      return;
+    this->offline_buffer_.pop_front();
+    sent++;
+  }
+
+  if (this->offline_buffer_.empty()) {
+    if (this->offline_dropped_ != 0) {
+      ESP_LOGW(TAG, "Replayed offline buffer, %u messages were dropped.", this->offline_dropped_);
+    } else {
+      ESP_LOGD(TAG, "Replayed offline buffer.");
+    }
+    this->offline_dropped_ = 0;
+  }
+}
+bool MQTTClientComponent::has_buffered_messages() const { return !this->offline_buffer_.empty(); }
+void MQTTClientComponent::set_offline_buffer_size(size_t offline_buffer_size) {
+  this->offline_buffer_size_ = offline_buffer_size;
+}
+void MQTTClientComponent::set_offline_replay_rate(uint16_t offline_replay_rate) {
+  this->offline_replay_rate_ = offline_replay_rate;
+}
+void MQTTClientComponent::set_offline_max_age(uint32_t offline_max_age) { this->offline_max_age_ = offline_max_age; }
+
 /** Check if the message topic matches the given subscription topic
  *
  * INFO: MQTT spec mandates that topics must not be empty and must be valid NULL-terminated UTF-8 strings.
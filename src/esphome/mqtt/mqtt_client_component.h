@@ -8,6 +8,7 @@
 #include <string>
 #include <functional>
 #include <vector>
+#include <deque>
 #include <ArduinoJson.h>
 #include <AsyncMqttClient.h>
 
@@ -36,6 +37,12 @@ struct MQTTMessage {
   bool retain;
 };
 
+/// internal struct for MQTT messages that were buffered while the client was disconnected.
+struct MQTTBufferedMessage {
+  MQTTMessage message;
+  uint32_t timestamp;  ///< millis() at the time the message was buffered.
+};
+
 /// internal struct for MQTT subscriptions.
 struct MQTTSubscription {
   std::string topic;
@@ -204,6 +211,34 @@ class MQTTClientComponent : public Component {
    */
   bool publish_json(const std::string &topic, const json_build_t &f, uint8_t qos = 0, bool retain = false);
 
+  /** Store a message that can't be sent right now because the client is disconnected.
+   *
+   * Buffered messages are replayed in order once the connection has been re-established, at most
+   * offline_replay_rate messages per loop() iteration. If the buffer is full, the oldest message is dropped.
+   *
+   * Each replayed message is published to "<topic>/history" as {"state": <payload>, "age": <ms>} with the QoS and
+   * retain flag of the original message, where age is the time between capturing and replaying the message, so
+   * that consumers can record it at its capture time. JSON payloads are embedded as objects, all others as strings.
+   *
+   * @param topic The topic.
+   * @param payload The payload.
+   * @param payload_length The length of the payload.
+   * @param qos The QoS of the message.
+   * @param retain Whether to retain the message.
+   * @return Whether the message was stored.
+   */
+  bool buffer_message(const std::string &topic, const char *payload, size_t payload_length, uint8_t qos = 0,
+                      bool retain = false);
+
+  /// Set the maximum number of messages buffered while disconnected. 0 disables buffering. Defaults to 64.
+  void set_offline_buffer_size(size_t offline_buffer_size);
+  /// Set how many buffered messages may be sent per loop() iteration after a reconnect. Defaults to 4.
+  void set_offline_replay_rate(uint16_t offline_replay_rate);
+  /// Set the maximum age (in ms) of buffered messages, older ones are discarded. 0 means no limit (default).
+  void set_offline_max_age(uint32_t offline_max_age);
+  /// Return whether there are still buffered messages waiting to be replayed.
+  bool has_buffered_messages() const;
+
   /// Setup the MQTT client, registering a bunch of callbacks and attempting to connect.
   void setup() override;
   void dump_config() override;
@@ -250,6 +285,9 @@ class MQTTClientComponent : public Component {
   void resubscribe_subscription_(MQTTSubscription *sub);
   void resubscribe_subscriptions_();
 
+  /// Send up to offline_replay_rate_ buffered messages, called from loop() while connected.
+  void replay_offline_buffer_();
+
   MQTTCredentials credentials_;
   /// The last will message. Disabled optional denotes it being default and
   /// an empty topic denotes the the feature being disabled.
@@ -283,6 +321,11 @@ class MQTTClientComponent : public Component {
   uint32_t connect_begin_;
   uint32_t last_connected_{0};
   optional<AsyncMqttClientDisconnectReason> disconnect_reason_{};
+  std::deque<MQTTBufferedMessage> offline_buffer_;
+  size_t offline_buffer_size_{64};
+  uint16_t offline_replay_rate_{4};
+  uint32_t offline_max_age_{0};
+  uint32_t offline_dropped_{0};
 };
 
 extern MQTTClientComponent *global_mqtt_client;
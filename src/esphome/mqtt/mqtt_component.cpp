@@ -48,12 +48,19 @@ const std::string MQTTComponent::get_command_topic_() const {
 bool MQTTComponent::publish(const std::string &topic, const std::string &payload) {
   if (topic.empty())
     return false;
+  if (this->offline_history_ && !this->is_connected_())
+    return global_mqtt_client->buffer_message(topic, payload.data(), payload.size(), 0, this->retain_);
   return global_mqtt_client->publish(topic, payload, 0, this->retain_);
 }
 
 bool MQTTComponent::publish_json(const std::string &topic, const json_build_t &f) {
   if (topic.empty())
     return false;
+  if (this->offline_history_ && !this->is_connected_()) {
+    size_t len;
+    const char *message = build_json(f, &len);
+    return global_mqtt_client->buffer_message(topic, message, len, 0, this->retain_);
+  }
   return global_mqtt_client->publish_json(topic, f, 0, this->retain_);
 }
 
@@ -124,6 +131,8 @@ bool MQTTComponent::send_discovery_() {
 }
 
 bool MQTTComponent::get_retain() const { return this->retain_; }
+void MQTTComponent::set_offline_history(bool offline_history) { this->offline_history_ = offline_history; }
+bool MQTTComponent::get_offline_history() const { return this->offline_history_; }
 
 bool MQTTComponent::is_discovery_enabled() const {
   return this->discovery_enabled_ && global_mqtt_client->is_discovery_enabled();
@@ -196,6 +205,10 @@ void MQTTComponent::call_loop() {
   if (!this->resend_state_ || !this->is_connected_()) {
     return;
   }
+  // Wait until buffered history has been replayed so that the latest state is sent last.
+  if (this->offline_history_ && global_mqtt_client->has_buffered_messages()) {
+    return;
+  }
 
   this->resend_state_ = false;
   if (this->is_discovery_enabled()) {
@@ -77,6 +77,15 @@ class MQTTComponent : public Component {
   void set_retain(bool retain);
   bool get_retain() const;
 
+  /** Set whether state messages published while disconnected should be buffered and replayed on reconnect.
+   *
+   * By default only the latest state is re-sent once the connection is re-established. With this
+   * option, every intermediate state change is kept in the MQTT client's offline buffer (full history)
+   * and replayed with its capture age to "<state topic>/history", see MQTTClientComponent::buffer_message.
+   */
+  void set_offline_history(bool offline_history);
+  bool get_offline_history() const;
+
   /// Disable discovery. Sets friendly name to "".
   void disable_discovery();
   bool is_discovery_enabled() const;
@@ -176,6 +185,7 @@ class MQTTComponent : public Component {
   std::string custom_state_topic_{};
   std::string custom_command_topic_{};
   bool retain_{true};
+  bool offline_history_{false};
   bool discovery_enabled_{true};
   Availability *availability_{nullptr};
   bool resend_state_{false};
@@ -375,6 +375,8 @@ void OTAComponent::start_safe_mode(uint8_t num_attempts, uint32_t enable_time) {
   this->safe_mode_enable_time_ = enable_time;
   this->safe_mode_num_attempts_ = num_attempts;
   this->rtc_ = global_preferences.make_preference<uint32_t>(233825507UL);
+  // the boot counter has to be stored before a possible crash
+  this->rtc_.set_write_delay(0);
   this->safe_mode_rtc_value_ = this->read_rtc_();
 
   ESP_LOGCONFIG(TAG, "There have been %u suspected unsuccessful boot attempts.", this->safe_mode_rtc_value_);
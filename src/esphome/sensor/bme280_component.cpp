@@ -45,8 +45,6 @@ static const uint8_t BME280_REGISTER_STATUS = 0xF3;
 static const uint8_t BME280_REGISTER_CONTROL = 0xF4;
 static const uint8_t BME280_REGISTER_CONFIG = 0xF5;
 static const uint8_t BME280_REGISTER_PRESSUREDATA = 0xF7;
-static const uint8_t BME280_REGISTER_TEMPDATA = 0xFA;
-static const uint8_t BME280_REGISTER_HUMIDDATA = 0xFD;
 
 static const uint8_t BME280_MODE_FORCED = 0b01;
 
@@ -193,38 +191,48 @@ void BME280Component::update() {
   meas_register |= (this->temperature_oversampling_ & 0b111) << 5;
   meas_register |= (this->pressure_oversampling_ & 0b111) << 2;
   meas_register |= 0b01;  // Forced mode
-  if (!this->write_byte(BME280_REGISTER_CONTROL, meas_register)) {
-    this->status_set_warning();
-    return;
-  }
 
   float meas_time = 1;
   meas_time += 2.3f * oversampling_to_time(this->temperature_oversampling_);
   meas_time += 2.3f * oversampling_to_time(this->pressure_oversampling_) + 0.575f;
   meas_time += 2.3f * oversampling_to_time(this->humidity_oversampling_) + 0.575f;
+  const uint32_t conversion = uint32_t(ceilf(meas_time));
 
-  this->set_timeout("data", uint32_t(ceilf(meas_time)), [this]() {
-    int32_t t_fine = 0;
-    float temperature = this->read_temperature_(&t_fine);
-    if (isnan(temperature)) {
-      ESP_LOGW(TAG, "Invalid temperature, cannot read pressure & humidity values.");
+  this->write_bytes_async(BME280_REGISTER_CONTROL, &meas_register, 1, [this, conversion](bool success) {
+    if (!success) {
+      // no measurement was started, the data registers still hold the previous values
+      ESP_LOGW(TAG, "Sending conversion request failed.");
       this->status_set_warning();
       return;
     }
-    float pressure = this->read_pressure_(t_fine);
-    float humidity = this->read_humidity_(t_fine);
-
-    ESP_LOGD(TAG, "Got temperature=%.1f°C pressure=%.1fhPa humidity=%.1f%%", temperature, pressure, humidity);
-    this->temperature_sensor_->publish_state(temperature);
-    this->pressure_sensor_->publish_state(pressure);
-    this->humidity_sensor_->publish_state(humidity);
-    this->status_clear_warning();
+    // Burst read pressure, temperature and humidity registers (0xF7-0xFE) once the measurement is done.
+    this->read_bytes_async(BME280_REGISTER_PRESSUREDATA, this->data_, 8, conversion, [this](bool success) {
+      if (!success) {
+        this->status_set_warning();
+        return;
+      }
+      this->publish_values_();
+    });
   });
 }
-float BME280Component::read_temperature_(int32_t *t_fine) {
-  uint8_t data[3];
-  if (!this->read_bytes(BME280_REGISTER_TEMPDATA, data, 3))
-    return NAN;
+void BME280Component::publish_values_() {
+  int32_t t_fine = 0;
+  float temperature = this->read_temperature_(this->data_ + 3, &t_fine);
+  if (isnan(temperature)) {
+    ESP_LOGW(TAG, "Invalid temperature, cannot read pressure & humidity values.");
+    this->status_set_warning();
+    return;
+  }
+  float pressure = this->read_pressure_(this->data_, t_fine);
+  float humidity = this->read_humidity_(this->data_ + 6, t_fine);
+
+  ESP_LOGD(TAG, "Got temperature=%.1f°C pressure=%.1fhPa humidity=%.1f%%", temperature, pressure, humidity);
+  this->temperature_sensor_->publish_state(temperature);
+  this->pressure_sensor_->publish_state(pressure);
+  this->humidity_sensor_->publish_state(humidity);
+  this->status_clear_warning();
+}
+float BME280Component::read_temperature_(const uint8_t *data, int32_t *t_fine) {
   int32_t adc = ((data[0] & 0xFF) << 16) | ((data[1] & 0xFF) << 8) | (data[2] & 0xFF);
   adc >>= 4;
   if (adc == 0x80000)
@@ -243,10 +251,7 @@ float BME280Component::read_temperature_(int32_t *t_fine) {
   return temperature / 100.0f;
 }
 
-float BME280Component::read_pressure_(int32_t t_fine) {
-  uint8_t data[3];
-  if (!this->read_bytes(BME280_REGISTER_PRESSUREDATA, data, 3))
-    return NAN;
+float BME280Component::read_pressure_(const uint8_t *data, int32_t t_fine) {
   int32_t adc = ((data[0] & 0xFF) << 16) | ((data[1] & 0xFF) << 8) | (data[2] & 0xFF);
   adc >>= 4;
   if (adc == 0x80000)
@@ -282,9 +287,9 @@ float BME280Component::read_pressure_(int32_t t_fine) {
   return (p / 256.0f) / 100.0f;
 }
 
-float BME280Component::read_humidity_(int32_t t_fine) {
-  uint16_t raw_adc;
-  if (!this->read_byte_16(BME280_REGISTER_HUMIDDATA, &raw_adc) || raw_adc == 0x8000)
+float BME280Component::read_humidity_(const uint8_t *data, int32_t t_fine) {
+  uint16_t raw_adc = (uint16_t(data[0]) << 8) | data[1];
+  if (raw_adc == 0x8000)
     return NAN;
 
   int32_t adc = raw_adc;
@@ -93,12 +93,14 @@ class BME280Component : public PollingComponent, public I2CDevice {
   void update() override;
 
  protected:
-  /// Read the temperature value and store the calculated ambient temperature in t_fine.
-  float read_temperature_(int32_t *t_fine);
-  /// Read the pressure value in hPa using the provided t_fine value.
-  float read_pressure_(int32_t t_fine);
-  /// Read the humidity value in % using the provided t_fine value.
-  float read_humidity_(int32_t t_fine);
+  /// Calculate and publish the values from the burst-read data registers.
+  void publish_values_();
+  /// Calculate the temperature value from the raw data and store the calculated ambient temperature in t_fine.
+  float read_temperature_(const uint8_t *data, int32_t *t_fine);
+  /// Calculate the pressure value in hPa from the raw data using the provided t_fine value.
+  float read_pressure_(const uint8_t *data, int32_t t_fine);
+  /// Calculate the humidity value in % from the raw data using the provided t_fine value.
+  float read_humidity_(const uint8_t *data, int32_t t_fine);
   uint8_t read_u8_(uint8_t a_register);
   uint16_t read_u16_le_(uint8_t a_register);
   int16_t read_s16_le_(uint8_t a_register);
@@ -111,6 +113,7 @@ class BME280Component : public PollingComponent, public I2CDevice {
   BME280TemperatureSensor *temperature_sensor_;
   BME280PressureSensor *pressure_sensor_;
   BME280HumiditySensor *humidity_sensor_;
+  uint8_t data_[8];  ///< Raw pressure (3), temperature (3) and humidity (2) data registers.
   enum ErrorCode {
     NONE = 0,
     COMMUNICATION_FAILED,
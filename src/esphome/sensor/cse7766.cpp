@@ -11,6 +11,16 @@ namespace sensor {
 
 static const char *TAG = "sensor.cse7766";
 
+void CSE7766Component::setup() {
+#ifdef USE_MQTT_SENSOR
+  // the sensors are registered by now, keep every reading for energy accounting while disconnected
+  for (Sensor *sensor : {static_cast<Sensor *>(this->voltage_sensor_), static_cast<Sensor *>(this->current_sensor_),
+                         static_cast<Sensor *>(this->power_sensor_)}) {
+    if (sensor != nullptr && sensor->get_mqtt() != nullptr)
+      sensor->get_mqtt()->set_offline_history(true);
+  }
+#endif
+}
 void CSE7766Component::loop() {
   const uint32_t now = millis();
   if (now - this->last_transmission_ >= 500) {
@@ -10,6 +10,8 @@
 #include "esphome/helpers.h"
 #include "esphome/log.h"
 
+#include <algorithm>
+
 ESPHOME_NAMESPACE_BEGIN
 
 namespace sensor {
@@ -43,9 +45,7 @@ void DallasComponent::setup() {
   ESP_LOGCONFIG(TAG, "Setting up DallasComponent...");
 
   yield();
-  disable_interrupts();
   std::vector<uint64_t> raw_sensors = this->one_wire_->search_vec();
-  enable_interrupts();
 
   for (auto &address : raw_sensors) {
     std::string s = uint64_to_string(address);
@@ -63,6 +63,7 @@ void DallasComponent::setup() {
     this->found_sensors_.push_back(address);
   }
 
+  std::vector<sequence_step_t> steps;
   for (auto sensor : this->sensors_) {
     if (sensor->get_index().has_value()) {
       if (*sensor->get_index() >= this->found_sensors_.size()) {
@@ -72,15 +73,34 @@ void DallasComponent::setup() {
       sensor->set_address(this->found_sensors_[*sensor->get_index()]);
     }
 
-    if (!sensor->setup_sensor()) {
-      this->status_set_error();
-    }
+    steps.push_back([this, sensor]() -> uint32_t {
+      if (!sensor->setup_sensor()) {
+        this->status_set_error();
+        return 0;
+      }
+      // allow the EEPROM write to finish before talking to the next sensor
+      return 20;
+    });
+    steps.push_back([this]() -> uint32_t {
+      this->one_wire_->reset();
+      return 0;
+    });
   }
+  steps.push_back([this]() -> uint32_t {
+    this->setup_done_ = true;
+    // the first update() was skipped while the sensors were being configured
+    this->update();
+    return 0;
+  });
+  this->start_sequence("setup", std::move(steps));
 }
 void DallasComponent::dump_config() {
   ESP_LOGCONFIG(TAG, "DallasComponent:");
   LOG_PIN("  Pin: ", this->one_wire_->get_pin());
   LOG_UPDATE_INTERVAL(this);
+  if (this->cycle_time_ != 0) {
+    ESP_LOGCONFIG(TAG, "  Last Bus Cycle Time: %u ms", this->cycle_time_);
+  }
 
   if (this->found_sensors_.empty()) {
     ESP_LOGW(TAG, "  Found no sensors!");
@@ -120,9 +140,14 @@ DallasTemperatureSensor *DallasComponent::get_sensor_by_index(const std::string
   return s;
 }
 void DallasComponent::update() {
+  if (!this->setup_done_)
+    // the bus is still in use by setup()
+    return;
+  // a cycle that is still reading is superseded by the new conversion
+  this->cancel_defer("read");
   this->status_clear_warning();
+  this->cycle_start_ = millis();
 
-  disable_interrupts();
   bool result;
   if (!this->one_wire_->reset()) {
     result = false;
@@ -131,7 +156,6 @@ void DallasComponent::update() {
     this->one_wire_->skip();
     this->one_wire_->write8(DALLAS_COMMAND_START_CONVERSION);
   }
-  enable_interrupts();
 
   if (!result) {
     ESP_LOGE(TAG, "Requesting conversion failed");
@@ -139,26 +163,37 @@ void DallasComponent::update() {
     return;
   }
 
-  for (auto *sensor : this->sensors_) {
-    this->set_timeout(sensor->get_address_name(), sensor->millis_to_wait_for_conversion(), [this, sensor] {
-      disable_interrupts();
-      bool res = sensor->read_scratch_pad();
-      enable_interrupts();
-
-      if (!res) {
-        this->status_set_warning();
-        return;
-      }
-      if (!sensor->check_scratch_pad()) {
-        this->status_set_warning();
-        return;
-      }
+  // All sensors on this bus convert at the same time, so wait once for the slowest resolution
+  // and then read the scratch pads back-to-back.
+  uint16_t wait = 0;
+  for (auto *sensor : this->sensors_)
+    wait = std::max(wait, sensor->millis_to_wait_for_conversion());
 
-      float tempc = sensor->get_temp_c();
-      ESP_LOGD(TAG, "'%s': Got Temperature=%.1f°C", sensor->get_name().c_str(), tempc);
-      sensor->publish_state(tempc);
-    });
+  this->set_timeout("read", wait, [this]() { this->read_next_sensor_(0); });
+}
+void DallasComponent::read_next_sensor_(size_t index) {
+  if (index >= this->sensors_.size()) {
+    this->cycle_time_ = millis() - this->cycle_start_;
+    ESP_LOGV(TAG, "Bus cycle took %u ms", this->cycle_time_);
+    return;
+  }
+  this->read_sensor_(this->sensors_[index]);
+  // read the next sensor in the next loop iteration so that other components run in between
+  this->defer("read", [this, index]() { this->read_next_sensor_(index + 1); });
+}
+void DallasComponent::read_sensor_(DallasTemperatureSensor *sensor) {
+  if (!sensor->read_scratch_pad()) {
+    this->status_set_warning();
+    return;
   }
+  if (!sensor->check_scratch_pad()) {
+    this->status_set_warning();
+    return;
+  }
+
+  float tempc = sensor->get_temp_c();
+  ESP_LOGD(TAG, "'%s': Got Temperature=%.1f°C", sensor->get_name().c_str(), tempc);
+  sensor->publish_state(tempc);
 }
 DallasComponent::DallasComponent(ESPOneWire *one_wire, uint32_t update_interval)
     : PollingComponent(update_interval), one_wire_(one_wire) {}
@@ -193,17 +228,11 @@ bool DallasTemperatureSensor::read_scratch_pad() {
   wire->select(this->address_);
   wire->write8(DALLAS_COMMAND_READ_SCRATCH_PAD);
 
-  for (unsigned char &i : this->scratch_pad_) {
-    i = wire->read8();
-  }
+  wire->read_bytes(this->scratch_pad_, sizeof(this->scratch_pad_));
   return true;
 }
 bool DallasTemperatureSensor::setup_sensor() {
-  disable_interrupts();
-  bool r = this->read_scratch_pad();
-  enable_interrupts();
-
-  if (!r) {
+  if (!this->read_scratch_pad()) {
     ESP_LOGE(TAG, "Reading scratchpad failed: reset");
     return false;
   }
@@ -236,23 +265,19 @@ bool DallasTemperatureSensor::setup_sensor() {
   }
 
   ESPOneWire *wire = this->parent_->get_one_wire();
-  disable_interrupts();
   if (wire->reset()) {
     wire->select(this->address_);
     wire->write8(DALLAS_COMMAND_WRITE_SCRATCH_PAD);
-    wire->write8(this->scratch_pad_[2]);  // high alarm temp
-    wire->write8(this->scratch_pad_[3]);  // low alarm temp
-    wire->write8(this->scratch_pad_[4]);  // resolution
+    // high alarm temp, low alarm temp, resolution
+    wire->write_bytes(this->scratch_pad_ + 2, 3);
     wire->reset();
 
     // write value to EEPROM
     wire->select(this->address_);
     wire->write8(0x48);
   }
-  enable_interrupts();
 
-  delay(20);  // allow it to finish operation
-  wire->reset();
+  // The EEPROM write takes up to 10ms, the caller waits and resets the bus before using it again.
   return true;
 }
 bool DallasTemperatureSensor::check_scratch_pad() {
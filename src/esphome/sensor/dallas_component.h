@@ -17,6 +17,10 @@ class DallasTemperatureSensor;
 /** Hub for dealing with dallas temperature sensor. Uses a OneWire interface.
  *
  * Get the individual sensors with `get_sensor_by_address` or `get_sensor_by_index`.
+ *
+ * All sensors on the bus are told to start a conversion at once (SKIP ROM), then after the
+ * conversion time of the slowest sensor all scratch pads are read back-to-back. Each bus (pin)
+ * has its own hub, so conversions on multiple buses run concurrently.
  */
 class DallasComponent : public PollingComponent {
  public:
@@ -58,9 +62,18 @@ class DallasComponent : public PollingComponent {
   ESPOneWire *get_one_wire() const;
 
  protected:
+  /// Read the scratch pad of a single sensor after the conversion and publish the value.
+  void read_sensor_(DallasTemperatureSensor *sensor);
+  /// Read the sensor at index, then defer reading the next one to the next loop iteration.
+  void read_next_sensor_(size_t index);
+
   ESPOneWire *one_wire_;
   std::vector<DallasTemperatureSensor *> sensors_;
   std::vector<uint64_t> found_sensors_;
+  /// Whether the sensors were configured in setup(), update() does nothing until then.
+  bool setup_done_{false};
+  uint32_t cycle_start_{0};
+  uint32_t cycle_time_{0};  ///< Time in ms from conversion start until all sensors were read.
 };
 
 /// Internal class that helps us create multiple sensors for one Dallas hub.
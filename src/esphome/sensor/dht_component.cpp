@@ -49,6 +49,27 @@ void DHTComponent::dump_config() {
 }
 
 void DHTComponent::update() {
+  if (this->model_ != DHT_MODEL_DHT11) {
+    this->read_and_publish_();
+    return;
+  }
+
+  // The DHT11 needs an 18ms start signal. Hold the line low without blocking the main loop
+  // and do the time-critical part with interrupts disabled afterwards.
+  this->start_sequence("read", {
+      [this]() -> uint32_t {
+        this->pin_->digital_write(false);
+        this->pin_->pin_mode(OUTPUT);
+        this->pin_->digital_write(false);
+        return 18;
+      },
+      [this]() -> uint32_t {
+        this->read_and_publish_();
+        return 0;
+      },
+  });
+}
+void DHTComponent::read_and_publish_() {
   float temperature, humidity;
   bool error;
   if (this->model_ == DHT_MODEL_AUTO_DETECT) {
@@ -90,18 +111,19 @@ bool HOT DHTComponent::read_sensor_(float *temperature, float *humidity, bool re
   *temperature = NAN;
 
   disable_interrupts();
-  this->pin_->digital_write(false);
-  this->pin_->pin_mode(OUTPUT);
-  this->pin_->digital_write(false);
-
-  if (this->model_ == DHT_MODEL_DHT11) {
-    delayMicroseconds(18000);
-  } else if (this->model_ == DHT_MODEL_SI7021) {
-    delayMicroseconds(500);
-    this->pin_->digital_write(true);
-    delayMicroseconds(40);
-  } else {
-    delayMicroseconds(800);
+  // For the DHT11, the start signal has already been sent by update().
+  if (this->model_ != DHT_MODEL_DHT11) {
+    this->pin_->digital_write(false);
+    this->pin_->pin_mode(OUTPUT);
+    this->pin_->digital_write(false);
+
+    if (this->model_ == DHT_MODEL_SI7021) {
+      delayMicroseconds(500);
+      this->pin_->digital_write(true);
+      delayMicroseconds(40);
+    } else {
+      delayMicroseconds(800);
+    }
   }
   this->pin_->pin_mode(INPUT_PULLUP);
   delayMicroseconds(40);
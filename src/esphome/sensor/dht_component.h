@@ -63,6 +63,8 @@ class DHTComponent : public PollingComponent {
   float get_setup_priority() const override;
 
  protected:
+  /// Read the sensor (the start signal for the DHT11 must already have been sent) and publish the values.
+  void read_and_publish_();
   bool read_sensor_(float *temperature, float *humidity, bool report_errors);
 
   GPIOPin *pin_;
@@ -29,6 +29,14 @@ void HLW8012Component::setup() {
     this->mark_failed();
     return;
   }
+#ifdef USE_MQTT_SENSOR
+  // the sensors are registered by now, keep every reading for energy accounting while disconnected
+  for (Sensor *sensor : {static_cast<Sensor *>(this->voltage_sensor_), static_cast<Sensor *>(this->current_sensor_),
+                         static_cast<Sensor *>(this->power_sensor_)}) {
+    if (sensor != nullptr && sensor->get_mqtt() != nullptr)
+      sensor->get_mqtt()->set_offline_history(true);
+  }
+#endif
 }
 void HLW8012Component::dump_config() {
   ESP_LOGCONFIG(TAG, "HLW8012:");
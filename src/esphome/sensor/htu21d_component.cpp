@@ -50,20 +50,26 @@ void HTU21DComponent::dump_config() {
   LOG_SENSOR("  ", "Humidity", this->humidity_);
 }
 void HTU21DComponent::update() {
-  uint16_t raw_temperature;
-  if (!this->read_byte_16(HTU21D_REGISTER_TEMPERATURE, &raw_temperature, 50)) {
-    this->status_set_warning();
-    return;
-  }
-
+  // Both conversions take up to 50ms, queue them on the bus instead of blocking the main loop.
+  this->read_bytes_async(HTU21D_REGISTER_TEMPERATURE, this->raw_temperature_, 2, 50, [this](bool success) {
+    if (!success) {
+      this->status_set_warning();
+      return;
+    }
+    this->read_bytes_async(HTU21D_REGISTER_HUMIDITY, this->raw_humidity_, 2, 50, [this](bool success) {
+      if (!success) {
+        this->status_set_warning();
+        return;
+      }
+      this->publish_values_();
+    });
+  });
+}
+void HTU21DComponent::publish_values_() {
+  uint16_t raw_temperature = (uint16_t(this->raw_temperature_[0]) << 8) | this->raw_temperature_[1];
   float temperature = (float(raw_temperature & 0xFFFC)) * 175.72f / 65536.0f - 46.85f;
 
-  uint16_t raw_humidity;
-  if (!this->read_byte_16(HTU21D_REGISTER_HUMIDITY, &raw_humidity, 50)) {
-    this->status_set_warning();
-    return;
-  }
-
+  uint16_t raw_humidity = (uint16_t(this->raw_humidity_[0]) << 8) | this->raw_humidity_[1];
   float humidity = (float(raw_humidity & 0xFFFC)) * 125.0f / 65536.0f - 6.0f;
   ESP_LOGD(TAG, "Got Temperature=%.1f°C Humidity=%.1f%%", temperature, humidity);
 
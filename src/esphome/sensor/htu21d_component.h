@@ -38,8 +38,13 @@ class HTU21DComponent : public PollingComponent, public I2CDevice {
   float get_setup_priority() const override;
 
  protected:
+  /// Convert the raw readings and publish them, called once both conversions are done.
+  void publish_values_();
+
   HTU21DTemperatureSensor *temperature_{nullptr};
   HTU21DHumiditySensor *humidity_{nullptr};
+  uint8_t raw_temperature_[2];
+  uint8_t raw_humidity_[2];
 };
 
 }  // namespace sensor
@@ -24,13 +24,22 @@ void MS5611Component::setup() {
     this->mark_failed();
     return;
   }
-  delay(100);
-  for (uint8_t offset = 0; offset < 6; offset++) {
-    if (!this->read_byte_16(MS5611_CMD_READ_PROM + (offset * 2), &this->prom_[offset])) {
-      this->mark_failed();
-      return;
-    }
-  }
+  // Wait for the reset to complete without blocking, then read the calibration PROM.
+  this->start_sequence("setup", {
+      [this]() -> uint32_t { return 100; },
+      [this]() -> uint32_t {
+        for (uint8_t offset = 0; offset < 6; offset++) {
+          if (!this->read_byte_16(MS5611_CMD_READ_PROM + (offset * 2), &this->prom_[offset])) {
+            this->mark_failed();
+            return SEQUENCE_ABORT;
+          }
+        }
+        this->prom_read_ = true;
+        // the first update() was skipped while the calibration was missing
+        this->update();
+        return 0;
+      },
+  });
 }
 void MS5611Component::dump_config() {
   ESP_LOGCONFIG(TAG, "MS5611:");
@@ -44,40 +53,44 @@ void MS5611Component::dump_config() {
 }
 float MS5611Component::get_setup_priority() const { return setup_priority::HARDWARE_LATE; }
 void MS5611Component::update() {
-  // request temperature reading
-  if (!this->write_bytes(MS5611_CMD_CONV_D2 + 0x08, nullptr, 0)) {
-    this->status_set_warning();
-    return;
-  }
-
-  auto f = std::bind(&MS5611Component::read_temperature_, this);
-  this->set_timeout("temperature", 10, f);
-}
-void MS5611Component::read_temperature_() {
-  uint8_t bytes[3];
-  if (!this->read_bytes(MS5611_CMD_ADC_READ, bytes, 3)) {
-    this->status_set_warning();
+  if (!this->prom_read_)
+    // still waiting for the reset in setup()
     return;
-  }
-  const uint32_t raw_temperature = (uint32_t(bytes[0]) << 16) | (uint32_t(bytes[1]) << 8) | (uint32_t(bytes[2]));
-
-  // request pressure reading
-  if (!this->write_bytes(MS5611_CMD_CONV_D1 + 0x08, nullptr, 0)) {
-    this->status_set_warning();
-    return;
-  }
-
-  auto f = std::bind(&MS5611Component::read_pressure_, this, raw_temperature);
-  this->set_timeout("pressure", 10, f);
+  this->start_sequence("update", {
+      // request temperature reading
+      [this]() -> uint32_t {
+        if (!this->write_bytes(MS5611_CMD_CONV_D2 + 0x08, nullptr, 0)) {
+          this->status_set_warning();
+          return SEQUENCE_ABORT;
+        }
+        return 10;
+      },
+      // read temperature, request pressure reading
+      [this]() -> uint32_t {
+        if (!this->read_adc_(&this->raw_temperature_) || !this->write_bytes(MS5611_CMD_CONV_D1 + 0x08, nullptr, 0)) {
+          this->status_set_warning();
+          return SEQUENCE_ABORT;
+        }
+        return 10;
+      },
+      // read pressure
+      [this]() -> uint32_t {
+        uint32_t raw_pressure;
+        if (!this->read_adc_(&raw_pressure)) {
+          this->status_set_warning();
+          return SEQUENCE_ABORT;
+        }
+        this->calculate_values_(this->raw_temperature_, raw_pressure);
+        return 0;
+      },
+  });
 }
-void MS5611Component::read_pressure_(uint32_t raw_temperature) {
+bool MS5611Component::read_adc_(uint32_t *value) {
   uint8_t bytes[3];
-  if (!this->read_bytes(MS5611_CMD_ADC_READ, bytes, 3)) {
-    this->status_set_warning();
-    return;
-  }
-  const uint32_t raw_pressure = (uint32_t(bytes[0]) << 16) | (uint32_t(bytes[1]) << 8) | (uint32_t(bytes[2]));
-  this->calculate_values_(raw_temperature, raw_pressure);
+  if (!this->read_bytes(MS5611_CMD_ADC_READ, bytes, 3))
+    return false;
+  *value = (uint32_t(bytes[0]) << 16) | (uint32_t(bytes[1]) << 8) | (uint32_t(bytes[2]));
+  return true;
 }
 void MS5611Component::calculate_values_(uint32_t raw_temperature, uint32_t raw_pressure) {
   const int32_t d_t = int32_t(raw_temperature) - (uint32_t(this->prom_[4]) << 8);
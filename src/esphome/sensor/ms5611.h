@@ -29,13 +29,16 @@ class MS5611Component : public PollingComponent, public I2CDevice {
   MS5611PressureSensor *get_pressure_sensor() const;
 
  protected:
-  void read_temperature_();
-  void read_pressure_(uint32_t raw_temperature);
+  /// Read the 24-bit result of the last conversion, return true if successful.
+  bool read_adc_(uint32_t *value);
   void calculate_values_(uint32_t raw_temperature, uint32_t raw_pressure);
 
   MS5611TemperatureSensor *temperature_sensor_;
   MS5611PressureSensor *pressure_sensor_;
   uint16_t prom_[6];
+  /// Whether the calibration PROM was read, update() does nothing until then.
+  bool prom_read_{false};
+  uint32_t raw_temperature_;
 };
 
 }  // namespace sensor
@@ -17,6 +17,7 @@ uint8_t next_uart_num = 1;
 UARTComponent::UARTComponent(uint32_t baud_rate) : baud_rate_(baud_rate) {}
 
 float UARTComponent::get_setup_priority() const { return setup_priority::PRE_HARDWARE; }
+uint32_t UARTComponent::get_baud_rate() const { return this->baud_rate_; }
 
 #ifdef ARDUINO_ARCH_ESP32
 void UARTComponent::setup() {
@@ -73,6 +73,7 @@ class UARTComponent : public Component, public Stream {
 
   void set_tx_pin(uint8_t tx_pin);
   void set_rx_pin(uint8_t rx_pin);
+  uint32_t get_baud_rate() const;
 
  protected:
   bool check_read_timeout_(size_t len = 1);
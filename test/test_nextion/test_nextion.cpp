@@ -0,0 +1,302 @@
+// Tests for the reply tracking of the Nextion component against a simulated Nextion on the other end of the UART.
+// Runs on an ESP32 without any wiring: platformio test -e test_esp32
+#include <Arduino.h>
+#include <unity.h>
+#include <deque>
+#include <functional>
+#include <string>
+#include <vector>
+#include "esphome/display/nextion.h"
+
+using namespace esphome;
+using namespace esphome::display;
+
+/// The default baud rate of the Nextion.
+static const uint32_t BAUD_RATE = 9600;
+/// Time for one byte on the wire in µs (8N1, 10 bits).
+static const uint32_t BYTE_TIME = 10000000UL / BAUD_RATE;
+/// Time the simulated Nextion needs to execute a command and to draw a page in µs.
+static const uint32_t EXECUTE_TIME = 2000;
+static const uint32_t PAGE_TIME = 150000;
+
+enum class ReplyMode {
+  ACK,
+  /// Reply 0x1A (variable name invalid).
+  ERROR,
+  /// No reply at all.
+  DROP,
+  /// One of the three 0xFF terminator bytes is lost.
+  GARBLE,
+  /// The reply arrives 300ms too late.
+  LATE,
+};
+
+/** A HardwareSerial that simulates a Nextion with bkcmd=3 instead of touching the UART.
+ *
+ * The written bytes arrive at the simulated Nextion at BAUD_RATE, it executes the commands one after another and
+ * its replies become readable at the time they would have arrived on the wire.
+ */
+class FakeNextionSerial : public HardwareSerial {
+ public:
+  FakeNextionSerial() : HardwareSerial(2) {}
+
+  size_t write(uint8_t data) override { return this->write(&data, 1); }
+  size_t write(const uint8_t *data, size_t len) override {
+    const uint32_t now = micros();
+    if (int32_t(this->wire_free_at_ - now) < 0)
+      this->wire_free_at_ = now;
+    for (size_t i = 0; i < len; i++) {
+      this->wire_free_at_ += BYTE_TIME;
+      this->command_ += char(data[i]);
+      if (this->command_.size() >= 3 && this->command_.compare(this->command_.size() - 3, 3, "\xFF\xFF\xFF") == 0) {
+        this->command_.resize(this->command_.size() - 3);
+        this->execute_(this->command_, this->wire_free_at_);
+        this->command_.clear();
+      }
+    }
+    return len;
+  }
+  int available() override {
+    this->receive_();
+    return this->rx_.size();
+  }
+  int read() override {
+    this->receive_();
+    if (this->rx_.empty())
+      return -1;
+    const uint8_t data = this->rx_.front();
+    this->rx_.pop_front();
+    return data;
+  }
+  int peek() override {
+    this->receive_();
+    return this->rx_.empty() ? -1 : this->rx_.front();
+  }
+  void flush() override {}
+
+  /// Send an event from the Nextion now, like a restart.
+  void send_event(const std::vector<uint8_t> &data) { this->pending_.push_back(Pending{micros(), data}); }
+
+  /// Decides how the simulated Nextion replies to each command.
+  std::function<ReplyMode(const std::string &)> reply_mode = [](const std::string &) { return ReplyMode::ACK; };
+  /// The commands the simulated Nextion received, in order.
+  std::vector<std::string> received;
+
+ protected:
+  struct Pending {
+    uint32_t at;
+    std::vector<uint8_t> data;
+  };
+
+  void execute_(const std::string &command, uint32_t received_at) {
+    this->received.push_back(command);
+    uint32_t start = received_at;
+    if (int32_t(this->busy_until_ - start) > 0)
+      start = this->busy_until_;
+    this->busy_until_ = start + (command.compare(0, 5, "page ") == 0 ? PAGE_TIME : EXECUTE_TIME);
+
+    std::vector<uint8_t> reply;
+    if (command.compare(0, 4, "get ") == 0) {
+      const uint32_t value = strtoul(command.c_str() + 4, nullptr, 10);
+      reply = {0x71, uint8_t(value), uint8_t(value >> 8), uint8_t(value >> 16), uint8_t(value >> 24)};
+    } else if (command.empty()) {
+      reply = {0x00};
+    } else {
+      reply = {0x01};
+    }
+    uint32_t reply_at = this->busy_until_;
+    switch (this->reply_mode(command)) {
+      case ReplyMode::ACK:
+        break;
+      case ReplyMode::ERROR:
+        reply = {0x1A};
+        break;
+      case ReplyMode::DROP:
+        return;
+      case ReplyMode::GARBLE:
+        reply.insert(reply.end(), {0xFF, 0xFF});
+        this->pending_.push_back(Pending{reply_at, reply});
+        return;
+      case ReplyMode::LATE:
+        reply_at += 300000;
+        break;
+    }
+    reply.insert(reply.end(), {0xFF, 0xFF, 0xFF});
+    this->pending_.push_back(Pending{reply_at, reply});
+  }
+  /// Move the bytes that arrived by now to the receive buffer.
+  void receive_() {
+    const uint32_t now = micros();
+    for (auto it = this->pending_.begin(); it != this->pending_.end();) {
+      if (int32_t(now - (it->at + it->data.size() * BYTE_TIME)) < 0) {
+        it++;
+        continue;
+      }
+      this->rx_.insert(this->rx_.end(), it->data.begin(), it->data.end());
+      it = this->pending_.erase(it);
+    }
+  }
+
+  std::string command_;
+  uint32_t wire_free_at_{0};
+  uint32_t busy_until_{0};
+  std::vector<Pending> pending_;
+  std::deque<uint8_t> rx_;
+};
+
+class FakeUARTComponent : public UARTComponent {
+ public:
+  explicit FakeUARTComponent(HardwareSerial *serial) : UARTComponent(BAUD_RATE) { this->hw_serial_ = serial; }
+};
+
+struct Fixture {
+  FakeNextionSerial serial;
+  FakeUARTComponent uart{&serial};
+  Nextion nextion{&uart, 0xFFFFFFFF};
+
+  Fixture() {
+    this->nextion.setup();
+    this->run(1000);
+  }
+  /// Run the main loop for ms milliseconds.
+  void run(uint32_t ms) {
+    const uint32_t start = millis();
+    while (millis() - start < ms) {
+      this->nextion.loop();
+      delay(1);
+    }
+  }
+  /// Number of times command was received by the simulated Nextion.
+  uint32_t received_count(const std::string &command) const {
+    uint32_t count = 0;
+    for (auto &received : this->serial.received)
+      if (received == command)
+        count++;
+    return count;
+  }
+};
+
+static std::string long_text(int i) {
+  char buffer[80];
+  snprintf(buffer, sizeof(buffer), "Line %d: the quick brown fox jumps over the lazy dog, twice over", i);
+  return buffer;
+}
+
+void test_setup_syncs() {
+  Fixture f;
+  TEST_ASSERT_EQUAL_UINT32(0, f.nextion.get_commands_failed());
+  TEST_ASSERT_EQUAL_UINT32(1, f.received_count("page 0"));
+}
+
+void test_burst_at_low_baud_rate_has_no_false_failures() {
+  Fixture f;
+  // 8 commands of ~80 bytes each need ~650ms on the wire, far longer than the reply timeout of one command
+  for (int i = 0; i < 20; i++)
+    f.nextion.set_component_text(("t" + to_string(i)).c_str(), long_text(i).c_str());
+  f.nextion.goto_page("1");
+  for (int i = 0; i < 4; i++)
+    f.nextion.set_component_value(("n" + to_string(i)).c_str(), i);
+  f.run(5000);
+  TEST_ASSERT_EQUAL_UINT32(0, f.nextion.get_commands_failed());
+  TEST_ASSERT_EQUAL_UINT32(1, f.received_count("page 1"));
+  TEST_ASSERT_EQUAL_UINT32(1, f.received_count("n3.val=3"));
+}
+
+void test_dropped_reply_resends_the_attributes() {
+  Fixture f;
+  f.serial.reply_mode = [](const std::string &command) {
+    return command == "t1.txt=\"b\"" ? ReplyMode::DROP : ReplyMode::ACK;
+  };
+  f.nextion.set_component_text("t0", "a");
+  f.nextion.set_component_text("t1", "b");
+  f.nextion.set_component_text("t2", "c");
+  f.run(1000);
+  // the reply to t2 is taken for the one to t1, so t2 times out
+  TEST_ASSERT_EQUAL_UINT32(1, f.nextion.get_commands_failed());
+
+  // which command really failed is unknown, so all attributes are sent again
+  f.serial.reply_mode = [](const std::string &) { return ReplyMode::ACK; };
+  f.nextion.set_component_text("t1", "b");
+  f.nextion.set_component_text("t2", "c");
+  f.run(1000);
+  TEST_ASSERT_EQUAL_UINT32(2, f.received_count("t1.txt=\"b\""));
+  TEST_ASSERT_EQUAL_UINT32(2, f.received_count("t2.txt=\"c\""));
+  TEST_ASSERT_EQUAL_UINT32(1, f.nextion.get_commands_failed());
+}
+
+void test_garbled_reply_recovers() {
+  Fixture f;
+  f.serial.reply_mode = [](const std::string &command) {
+    return command == "t1.txt=\"b\"" ? ReplyMode::GARBLE : ReplyMode::ACK;
+  };
+  f.nextion.set_component_text("t0", "a");
+  f.nextion.set_component_text("t1", "b");
+  f.nextion.set_component_text("t2", "c");
+  f.nextion.set_component_text("t3", "d");
+  f.run(2000);
+  const uint32_t failed = f.nextion.get_commands_failed();
+  TEST_ASSERT_TRUE(failed >= 1);
+
+  // after the sync, replies are matched again
+  f.serial.reply_mode = [](const std::string &) { return ReplyMode::ACK; };
+  f.nextion.set_component_text("t4", "e");
+  f.nextion.set_component_text("t5", "f");
+  f.run(1000);
+  TEST_ASSERT_EQUAL_UINT32(failed, f.nextion.get_commands_failed());
+  TEST_ASSERT_EQUAL_UINT32(1, f.received_count("t5.txt=\"f\""));
+}
+
+void test_late_reply_is_not_matched_to_the_next_command() {
+  Fixture f;
+  f.serial.reply_mode = [](const std::string &command) {
+    if (command == "t0.txt=\"a\"")
+      return ReplyMode::LATE;
+    if (command == "t1.txt=\"b\"")
+      return ReplyMode::ERROR;
+    return ReplyMode::ACK;
+  };
+  f.nextion.set_component_text("t0", "a");
+  f.run(150);
+  // t0 timed out, its late ACK must not be taken for the reply to t1
+  f.nextion.set_component_text("t1", "b");
+  f.run(1000);
+  TEST_ASSERT_EQUAL_UINT32(2, f.nextion.get_commands_failed());
+
+  // t1 failed, so it's sent again
+  f.serial.reply_mode = [](const std::string &) { return ReplyMode::ACK; };
+  f.nextion.set_component_text("t1", "b");
+  f.run(500);
+  TEST_ASSERT_EQUAL_UINT32(2, f.received_count("t1.txt=\"b\""));
+}
+
+void test_restart_forgets_display_state() {
+  Fixture f;
+  f.nextion.set_component_text("t0", "a");
+  f.run(500);
+  f.nextion.set_component_text("t0", "a");
+  f.run(500);
+  TEST_ASSERT_EQUAL_UINT32(1, f.received_count("t0.txt=\"a\""));
+
+  f.serial.send_event({0x88, 0xFF, 0xFF, 0xFF});
+  f.run(500);
+  TEST_ASSERT_EQUAL_UINT32(2, f.received_count("bkcmd=3"));
+  f.nextion.set_component_text("t0", "a");
+  f.run(500);
+  TEST_ASSERT_EQUAL_UINT32(2, f.received_count("t0.txt=\"a\""));
+  TEST_ASSERT_EQUAL_UINT32(0, f.nextion.get_commands_failed());
+}
+
+void setup() {
+  // wait for the serial monitor of the test runner
+  delay(2000);
+  UNITY_BEGIN();
+  RUN_TEST(test_setup_syncs);
+  RUN_TEST(test_burst_at_low_baud_rate_has_no_false_failures);
+  RUN_TEST(test_dropped_reply_resends_the_attributes);
+  RUN_TEST(test_garbled_reply_recovers);
+  RUN_TEST(test_late_reply_is_not_matched_to_the_next_command);
+  RUN_TEST(test_restart_forgets_display_state);
+  UNITY_END();
+}
+
+void loop() {}